@@ -24,100 +24,779 @@
 #pragma once
 
 #include <future>
+#include <chrono>
 #include <tuple>
 #include <functional>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
+#include <pool-allocator/pool-allocator.hpp>
+#include <cancellation/cancellation.hpp>
+
 namespace abstract_task 
 {
-    template <typename T>
+    // 5 pointers of inline storage + the vtable pointer -> a task occupies 48 bytes
+    constexpr static std::size_t DEFAULT_INLINE_SIZE{ 5 * sizeof(void*) };
+
+    namespace detail
+    {
+        // Compiler-generated name of T (e.g. for profiler zones), lives in static storage, not null-terminated
+        template <typename T>
+        [[nodiscard]] constexpr std::string_view TypeName() noexcept
+        {
+#if defined (_MSC_VER)
+            std::string_view name{ __FUNCSIG__ }; // "... TypeName<T>(void) noexcept"
+            const auto begin{ name.find("TypeName<") + 9 };
+            const auto end{ name.rfind(">(void)") };
+#else
+            std::string_view name{ __PRETTY_FUNCTION__ }; // "... TypeName() [with T = T; ...]" or "... TypeName() [T = T]"
+            const auto begin{ name.find("T = ") + 4 };
+            auto end{ name.find(';', begin) };
+
+            if (end == std::string_view::npos)
+            {
+                end = name.rfind(']');
+            }
+#endif
+            return name.substr(begin, end - begin);
+        }
+    }
+
+    // HeapAllocator (stateless, the buffer allocator interface) holds the callables which don't fit inline
+    template <typename T, std::size_t InlineSize = DEFAULT_INLINE_SIZE, typename HeapAllocator = memory::PoolAllocator>
     class Task;
 
-    template <typename ReturnType, typename... Args>
-    class Task<ReturnType(Args...)>
+    template <typename ReturnType, typename... Args, std::size_t InlineSize, typename HeapAllocator>
+    class Task<ReturnType(Args...), InlineSize, HeapAllocator>
     {
-    public:
-        Task() = default;
+        struct VTable
+        {
+            ReturnType (*Invoke)(void* storage, Args&&... args);
+            void (*Relocate)(void* destination, void* source) noexcept; // move-construct into destination and destroy source
+            void (*Destroy)(void* storage) noexcept;
+            std::string_view Name;
+        };
+
+        // Callables that don't fit (or may throw while moving) go to the heap, only the pointer is kept inline
+        template <typename FunctionType>
+        constexpr static bool IS_INLINE
+        { 
+            sizeof(FunctionType) <= InlineSize && 
+            alignof(FunctionType) <= alignof(std::max_align_t) && 
+            std::is_nothrow_move_constructible_v<FunctionType> 
+        };
 
         template <typename FunctionType>
-        explicit Task(FunctionType&& function)
+        [[nodiscard]] static FunctionType* Get(void* storage) noexcept
         {
-            mInternalFunction = reinterpret_cast<void*>(new FunctionType{ std::move(function) });
-        
-            mCleaner = [](void* function) -> void
+            if constexpr (IS_INLINE<FunctionType>)
             {
-                auto* typed_function_ptr{ reinterpret_cast<FunctionType*>(function) };
-                delete typed_function_ptr;
-            };
-
-            mInvoke = [](void* function, Args&&... args) -> ReturnType
+                return std::launder(reinterpret_cast<FunctionType*>(storage));
+            }
+            else
             {
-                auto typed_function_ptr{ reinterpret_cast<FunctionType*>(function) };
-                return (*typed_function_ptr)(std::forward<Args>(args)...);
-            };
+                return *reinterpret_cast<FunctionType**>(storage);
+            }
         }
 
-        ~Task() noexcept 
+        template <typename FunctionType>
+        constexpr static VTable VTABLE
         {
-            if (mCleaner)
+            .Invoke = [](void* storage, Args&&... args) -> ReturnType
+            {
+                return (*Get<FunctionType>(storage))(std::forward<Args>(args)...);
+            },
+
+            .Relocate = [](void* destination, void* source) noexcept -> void
             {
-                mCleaner(mInternalFunction);
+                if constexpr (IS_INLINE<FunctionType>)
+                {
+                    auto* typed_function_ptr{ Get<FunctionType>(source) };
+
+                    ::new (destination) FunctionType{ std::move(*typed_function_ptr) };
+                    typed_function_ptr->~FunctionType();
+                }
+                else
+                {
+                    ::new (destination) FunctionType*{ Get<FunctionType>(source) };
+                }
+            },
+
+            .Destroy = [](void* storage) noexcept -> void
+            {
+                if constexpr (IS_INLINE<FunctionType>)
+                {
+                    Get<FunctionType>(storage)->~FunctionType();
+                }
+                else
+                {
+                    auto* function_ptr{ Get<FunctionType>(storage) };
+
+                    function_ptr->~FunctionType();
+                    HeapAllocator{}.Deallocate(function_ptr, sizeof(FunctionType), alignof(FunctionType));
+                }
+            },
+
+            .Name = detail::TypeName<FunctionType>()
+        };
+
+    public:
+        constexpr static std::size_t INLINE_SIZE{ InlineSize };
+
+    public:
+        Task() noexcept = default;
+
+        // noexcept when the callable is stored inline and its construction can't throw
+        template <typename FunctionType>
+            requires (!std::is_same_v<std::remove_cvref_t<FunctionType>, Task>)
+        explicit Task(FunctionType&& function) noexcept(IS_INLINE<std::decay_t<FunctionType>> && std::is_nothrow_constructible_v<std::decay_t<FunctionType>, FunctionType>)
+        {
+            using function_t = std::decay_t<FunctionType>;
+
+            if constexpr (IS_INLINE<function_t>)
+            {
+                ::new (static_cast<void*>(mStorage)) function_t{ std::forward<FunctionType>(function) };
             }
+            else
+            {
+                void* heap_storage{ HeapAllocator{}.Allocate(sizeof(function_t), alignof(function_t)) };
+
+                try
+                {
+                    ::new (static_cast<void*>(mStorage)) function_t*{ ::new (heap_storage) function_t{ std::forward<FunctionType>(function) } };
+                }
+                catch (...)
+                {
+                    HeapAllocator{}.Deallocate(heap_storage, sizeof(function_t), alignof(function_t));
+                    throw;
+                }
+            }
+
+            mVTable = &VTABLE<function_t>;
+        }
+
+        ~Task() noexcept 
+        {
+            Reset();
         }
 
         Task(const Task& other) = delete;
         Task(Task&& other) noexcept
         {
-            mInternalFunction = other.mInternalFunction;
-            other.mInternalFunction = nullptr;
-
-            mCleaner = std::move(other.mCleaner);
-            mInvoke = std::move(other.mInvoke);
+            Steal(other);
         }
 
         Task& operator=(const Task& other) = delete;
-        [[nodiscard]] Task& operator=(Task&& other) noexcept
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                Steal(other);
+            }
+
+            return *this;
+        }
+
+        // Arguments are taken like std::function does: references stay references, values are moved into the callable.
+        // An empty (or moved-from) task throws std::bad_function_call, like std::function
+        ReturnType operator()(Args... args)
+        {
+            if (mVTable == nullptr)
+            {
+                throw std::bad_function_call{};
+            }
+
+            return mVTable->Invoke(mStorage, std::forward<Args>(args)...);
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return mVTable != nullptr;
+        }
+
+        // Type name of the stored callable, empty for an empty task
+        [[nodiscard]] std::string_view TypeName() const noexcept
+        {
+            return mVTable != nullptr ? mVTable->Name : std::string_view{};
+        }
+
+    private:
+        void Reset() noexcept
+        {
+            if (mVTable != nullptr)
+            {
+                mVTable->Destroy(mStorage);
+                mVTable = nullptr;
+            }
+        }
+
+        void Steal(Task& other) noexcept
+        {
+            if (other.mVTable != nullptr)
+            {
+                other.mVTable->Relocate(mStorage, other.mStorage);
+
+                mVTable = other.mVTable;
+                other.mVTable = nullptr;
+            }
+        }
+
+    private:
+        alignas(std::max_align_t) std::byte mStorage[InlineSize];
+        const VTable* mVTable{ nullptr };
+    };
+
+    template <typename T>
+    class Future;
+
+    template <typename T>
+    class Promise;
+
+    // One-shot result shared by a Promise and a Future: an atomic status and inline storage for the value, no mutex/condvar
+    template <typename T>
+    class SharedState
+    {
+        friend class Future<T>;
+        friend class Promise<T>;
+
+        struct Void {};
+        using value_t = std::conditional_t<std::is_void_v<T>, Void, T>;
+
+        enum Status : std::uint32_t
+        {
+            PENDING   = 0,
+            VALUE     = 1,
+            EXCEPTION = 2,
+            READY     = VALUE | EXCEPTION,
+            WAITING   = 4 // somebody sleeps in Wait() -> the setter has to notify
+        };
+
+    public:
+        SharedState() noexcept = default;
+
+        ~SharedState() noexcept
+        {
+            if ((mStatus.load(std::memory_order_relaxed) & VALUE) != 0)
+            {
+                std::destroy_at(Value());
+            }
+        }
+
+        SharedState(const SharedState& other) = delete;
+        SharedState& operator=(const SharedState& other) = delete;
+
+        // The promise and the future usually live on different threads, the pool takes the cross-thread free off malloc
+        [[nodiscard]] static void* operator new(std::size_t bytes)
+        {
+            return memory::PoolAllocator{}.Allocate(bytes, alignof(SharedState));
+        }
+
+        static void operator delete(void* pointer, std::size_t bytes) noexcept
+        {
+            memory::PoolAllocator{}.Deallocate(pointer, bytes, alignof(SharedState));
+        }
+
+    private:
+        [[nodiscard]] inline value_t* Value() noexcept
+        {
+            return std::launder(reinterpret_cast<value_t*>(mStorage));
+        }
+
+        [[nodiscard]] inline bool IsReady() const noexcept
+        {
+            return (mStatus.load(std::memory_order_acquire) & READY) != 0;
+        }
+
+        void Wait() noexcept
+        {
+            auto status{ mStatus.load(std::memory_order_acquire) };
+
+            while ((status & READY) == 0)
+            {
+                if ((status & WAITING) == 0 && !mStatus.compare_exchange_weak(status, status | WAITING, std::memory_order_acquire))
+                {
+                    continue;
+                }
+
+                mStatus.wait(status | WAITING, std::memory_order_acquire);
+                status = mStatus.load(std::memory_order_acquire);
+            }
+        }
+
+        void Publish(Status status) noexcept
+        {
+            if ((mStatus.exchange(status, std::memory_order_acq_rel) & WAITING) != 0)
+            {
+                mStatus.notify_all();
+            }
+        }
+
+        void Acquire() noexcept
+        {
+            mReferences.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void Release() noexcept
+        {
+            if (mReferences.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                delete this;
+            }
+        }
+
+    private:
+        std::atomic<std::uint32_t> mStatus{ PENDING };
+        std::atomic<std::uint32_t> mReferences{ 1 }; // the promise, the future takes its own in Promise::GetFuture
+
+        std::exception_ptr mException;
+        alignas(value_t) std::byte mStorage[sizeof(value_t)];
+    };
+
+    template <typename T>
+    class Future
+    {
+    public:
+        Future() noexcept = default;
+
+        explicit Future(SharedState<T>* state) noexcept : 
+            mState{ state }
+        { }
+
+        ~Future() noexcept
+        {
+            if (mState != nullptr)
+            {
+                mState->Release();
+            }
+        }
+
+        Future(const Future& other) = delete;
+        Future(Future&& other) noexcept : 
+            mState{ std::exchange(other.mState, nullptr) }
+        { }
+
+        Future& operator=(const Future& other) = delete;
+        Future& operator=(Future&& other) noexcept
+        {
+            Future released{ std::move(other) };
+            std::swap(mState, released.mState);
+
+            return *this;
+        }
+
+        [[nodiscard]] inline bool IsValid() const noexcept
         {
-            mInternalFunction = other.mInternalFunction;
-            other.mInternalFunction = nullptr;
+            return mState != nullptr;
+        }
+
+        [[nodiscard]] inline bool IsReady() const noexcept
+        {
+            return mState->IsReady();
+        }
+
+        void Wait() const noexcept
+        {
+            mState->Wait();
+        }
 
-            mCleaner = std::move(other.mCleaner);
-            mInvoke = std::move(other.mInvoke);
+        // Blocks until the result is set, rethrows the exception of the task, may be called once
+        T Get()
+        {
+            mState->Wait();
+
+            auto* state{ std::exchange(mState, nullptr) };
+            struct Releaser { SharedState<T>* State; ~Releaser() noexcept { State->Release(); } } releaser{ state };
+
+            if ((state->mStatus.load(std::memory_order_acquire) & SharedState<T>::EXCEPTION) != 0)
+            {
+                std::rethrow_exception(state->mException);
+            }
+
+            if constexpr (!std::is_void_v<T>)
+            {
+                return std::move(*state->Value());
+            }
+        }
+
+    private:
+        SharedState<T>* mState{ nullptr };
+    };
+
+    template <typename T>
+    class Promise
+    {
+    public:
+        Promise() : 
+            mState{ new SharedState<T>{} }
+        { }
+
+        // A promise destroyed without a result completes its future with std::future_errc::broken_promise
+        ~Promise() noexcept
+        {
+            if (mState != nullptr)
+            {
+                if (!mState->IsReady())
+                {
+                    SetException(std::make_exception_ptr(std::future_error{ std::future_errc::broken_promise }));
+                }
+
+                mState->Release();
+            }
+        }
+
+        Promise(const Promise& other) = delete;
+        Promise(Promise&& other) noexcept : 
+            mState{ std::exchange(other.mState, nullptr) },
+            mIsFutureRetrieved{ other.mIsFutureRetrieved }
+        { }
+
+        Promise& operator=(const Promise& other) = delete;
+        Promise& operator=(Promise&& other) noexcept
+        {
+            Promise released{ std::move(other) };
+            std::swap(mState, released.mState);
+            std::swap(mIsFutureRetrieved, released.mIsFutureRetrieved);
 
             return *this;
         }
 
-        [[nodiscard]] ReturnType operator()(Args&&... args)
+        // May be called once (like std::promise, the second call throws std::future_errc::future_already_retrieved)
+        [[nodiscard]] Future<T> GetFuture()
         {
-            return mInvoke(mInternalFunction, std::forward<Args>(args)...);
+            if (mIsFutureRetrieved)
+            {
+                throw std::future_error{ std::future_errc::future_already_retrieved };
+            }
+
+            mIsFutureRetrieved = true;
+            mState->Acquire();
+
+            return Future<T>{ mState };
+        }
+
+        template <typename... ValueArgs>
+        void SetValue(ValueArgs&&... value_args)
+        {
+            std::construct_at(mState->Value(), std::forward<ValueArgs>(value_args)...);
+            mState->Publish(SharedState<T>::VALUE);
+        }
+
+        void SetException(std::exception_ptr exception) noexcept
+        {
+            mState->mException = std::move(exception);
+            mState->Publish(SharedState<T>::EXCEPTION);
         }
 
     private:
-        void* mInternalFunction;
+        SharedState<T>* mState;
+        bool mIsFutureRetrieved{ false };
+    };
 
-        std::function<void(void*)> mCleaner;
-        std::function<ReturnType(void*, Args&&...)> mInvoke;
+    // Tags for the CreateTask overloads:
+    // LIGHTWEIGHT -> the result is delivered through abstract_task::Future instead of std::future
+    // DETACHED    -> fire-and-forget, no future at all (the task returns -1 if the function has thrown)
+    struct LightweightTag { explicit LightweightTag() = default; };
+    struct DetachedTag { explicit DetachedTag() = default; };
+
+    constexpr static LightweightTag LIGHTWEIGHT{};
+    constexpr static DetachedTag DETACHED{};
+
+    // The future of a task which was cancelled or has expired before it ran holds this exception
+    class TaskCancelled : public std::exception
+    {
+    public:
+        [[nodiscard]] const char* what() const noexcept override
+        {
+            return "the task was cancelled before it ran";
+        }
     };
 
-    template <typename FunctionType, typename... Args>
-    [[nodiscard]] auto CreateTask(FunctionType&& function, Args&&... args)
+    // Passed in front of the function to CreateTask/PackageTask (after the tag, if any).
+    // A cancelled or expired task doesn't call the function, it only completes its future with TaskCancelled:
+    // the cancellation check is one atomic load, the clock is read only for the tasks with a deadline.
+    struct TaskOptions
     {
-        std::packaged_task<typename std::invoke_result_t<FunctionType, Args...>(Args...)> packaged_task{ std::move(function) };
-        auto future{ packaged_task.get_future() };
+        using clock_t = std::chrono::steady_clock;
+
+        cancellation::CancellationToken Token{};
+        clock_t::time_point Deadline{ clock_t::time_point::max() };
+
+        [[nodiscard]] bool IsCancelled() const noexcept
+        {
+            return Token.IsCancelled() || (Deadline != clock_t::time_point::max() && clock_t::now() >= Deadline);
+        }
+    };
 
-        Task<std::int32_t()> abstract_task
+    namespace detail
+    {
+        // Options of the tasks created without TaskOptions, the check is compiled out
+        struct NoOptions
         {
-            [m_func = std::move(packaged_task), args = std::make_tuple(std::forward<Args>(args)...)]() mutable -> std::int32_t
+            [[nodiscard]] constexpr bool IsCancelled() const noexcept
             {
-                std::apply([m_func = std::move(m_func)](auto&&... args) mutable -> void
+                return false;
+            }
+        };
+
+        // One shared exception object: cancelling a task only bumps its reference count, nothing is allocated
+        [[nodiscard]] inline std::exception_ptr CancelledException() noexcept
+        {
+            static const std::exception_ptr exception{ std::make_exception_ptr(TaskCancelled{}) };
+            return exception;
+        }
+
+        template <typename Signature>
+        struct TaskFactory;
+
+        // Signature of the produced task: TaskReturnType(CallArgs...)
+        // - the user function is called as function(call_args..., bound_args...), everything is forwarded and the bound arguments are moved out
+        // - TaskReturnType is void or an integral status: 0 -> success, -1 -> the function has thrown (DETACHED only)
+        template <typename TaskReturnType, typename... CallArgs>
+        struct TaskFactory<TaskReturnType(CallArgs...)>
+        {
+            static_assert(std::is_void_v<TaskReturnType> || std::is_integral_v<TaskReturnType>, "The task returns void or a status");
+
+            using task_return_t = TaskReturnType;
+
+            template <typename FunctionType, typename... Args>
+            using result_t = std::invoke_result_t<std::decay_t<FunctionType>, CallArgs..., std::unwrap_ref_decay_t<Args>...>;
+
+            // body(call_args...) -> bool: false if the function has failed
+            // Wrap returns the callable with the task signature, Make type-erases it
+            template <typename Body>
+            [[nodiscard]] static auto Wrap(Body&& body)
+            {
+                return [body = std::forward<Body>(body)](CallArgs... call_args) mutable -> TaskReturnType
                 {
-                    m_func(args...);
-                }, std::move(args));
+                    [[maybe_unused]] bool is_succeeded{ body(std::forward<CallArgs>(call_args)...) };
+
+                    if constexpr (!std::is_void_v<TaskReturnType>)
+                    {
+                        return is_succeeded ? TaskReturnType{ 0 } : static_cast<TaskReturnType>(-1);
+                    }
+                };
+            }
+
+            template <typename Body>
+            [[nodiscard]] static Task<TaskReturnType(CallArgs...)> Make(Body&& body)
+            {
+                return Task<TaskReturnType(CallArgs...)>{ Wrap(std::forward<Body>(body)) };
+            }
 
-                return 0;
+            template <typename FunctionType, typename BoundArgs>
+            static decltype(auto) Invoke(FunctionType& function, BoundArgs& bound_args, CallArgs&&... call_args)
+            {
+                return std::apply([&](auto&&... args) -> decltype(auto)
+                {
+                    return std::invoke(std::move(function), std::forward<CallArgs>(call_args)..., std::forward<decltype(args)>(args)...);
+                }, std::move(bound_args));
             }
         };
+    }
+
+    namespace detail
+    {
+        // body(options, call_args...) with the options held next to it, not captured:
+        // a lambda capture of the empty NoOptions still takes a byte (and the padding after it), this member takes none
+        template <typename OptionsType, typename BodyType>
+        struct OptionsBody
+        {
+            [[no_unique_address]] OptionsType Options;
+            BodyType Body;
+
+            template <typename... CallArgs>
+            bool operator()(CallArgs&&... call_args)
+            {
+                return Body(Options, std::forward<CallArgs>(call_args)...);
+            }
+        };
+
+        template <typename Options, typename Body>
+        [[nodiscard]] auto BindOptions(Options&& options, Body&& body)
+        {
+            return OptionsBody<std::decay_t<Options>, std::decay_t<Body>>{ std::forward<Options>(options), std::forward<Body>(body) };
+        }
+
+        template <typename Signature, typename Options, typename FunctionType, typename... Args>
+        [[nodiscard]] auto PackageTask(Options&& options, FunctionType&& function, Args&&... args)
+        {
+            using factory_t = TaskFactory<Signature>;
+            using result_t = typename factory_t::template result_t<FunctionType, Args...>;
+
+            // std::promise instead of std::packaged_task: only the promise takes an allocator for its shared state
+            std::promise<result_t> promise{ std::allocator_arg, memory::PoolStdAllocator<std::byte>{} };
+            auto future{ promise.get_future() };
+
+            auto callable
+            {
+                factory_t::Wrap(BindOptions(std::forward<Options>(options), [promise = std::move(promise), function = std::forward<FunctionType>(function), args = std::make_tuple(std::forward<Args>(args)...)](auto& task_options, auto&&... call_args) mutable -> bool
+                {
+                    if (task_options.IsCancelled())
+                    {
+                        promise.set_exception(CancelledException());
+                        return true;
+                    }
+
+                    try
+                    {
+                        if constexpr (std::is_void_v<result_t>)
+                        {
+                            factory_t::Invoke(function, args, std::forward<decltype(call_args)>(call_args)...);
+                            promise.set_value();
+                        }
+                        else
+                        {
+                            promise.set_value(factory_t::Invoke(function, args, std::forward<decltype(call_args)>(call_args)...));
+                        }
+                    }
+                    catch (...)
+                    {
+                        promise.set_exception(std::current_exception());
+                    }
+
+                    return true;
+                }))
+            };
+
+            return std::make_pair(std::move(callable), std::move(future));
+        }
+
+        template <typename Signature, typename Options, typename FunctionType, typename... Args>
+        [[nodiscard]] auto CreateLightweightTask(Options&& options, FunctionType&& function, Args&&... args)
+        {
+            using factory_t = TaskFactory<Signature>;
+            using result_t = typename factory_t::template result_t<FunctionType, Args...>;
+
+            Promise<result_t> promise{};
+            auto future{ promise.GetFuture() };
+
+            auto abstract_task
+            {
+                factory_t::Make(BindOptions(std::forward<Options>(options), [promise = std::move(promise), function = std::forward<FunctionType>(function), args = std::make_tuple(std::forward<Args>(args)...)](auto& task_options, auto&&... call_args) mutable -> bool
+                {
+                    if (task_options.IsCancelled())
+                    {
+                        promise.SetException(CancelledException());
+                        return true;
+                    }
+
+                    try
+                    {
+                        if constexpr (std::is_void_v<result_t>)
+                        {
+                            factory_t::Invoke(function, args, std::forward<decltype(call_args)>(call_args)...);
+                            promise.SetValue();
+                        }
+                        else
+                        {
+                            promise.SetValue(factory_t::Invoke(function, args, std::forward<decltype(call_args)>(call_args)...));
+                        }
+                    }
+                    catch (...)
+                    {
+                        promise.SetException(std::current_exception());
+                    }
 
-        return std::make_pair(std::move(abstract_task), std::move(future));
+                    return true;
+                }))
+            };
+
+            return std::make_pair(std::move(abstract_task), std::move(future));
+        }
+
+        // A cancelled detached task is simply skipped
+        template <typename Signature, typename Options, typename FunctionType, typename... Args>
+        [[nodiscard]] auto CreateDetachedTask(Options&& options, FunctionType&& function, Args&&... args)
+        {
+            using factory_t = TaskFactory<Signature>;
+
+            return factory_t::Make(BindOptions(std::forward<Options>(options), [function = std::forward<FunctionType>(function), args = std::make_tuple(std::forward<Args>(args)...)](auto& task_options, auto&&... call_args) mutable -> bool
+            {
+                if (task_options.IsCancelled())
+                {
+                    return true;
+                }
+
+                if constexpr (std::is_void_v<typename factory_t::task_return_t>)
+                {
+                    factory_t::Invoke(function, args, std::forward<decltype(call_args)>(call_args)...);
+                }
+                else
+                {
+                    try
+                    {
+                        factory_t::Invoke(function, args, std::forward<decltype(call_args)>(call_args)...);
+                    }
+                    catch (...)
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }));
+        }
+    }
+
+    // The same as CreateTask, but the callable isn't type-erased yet: { callable, std::future }.
+    // Task{ std::move(callable) } or LFQueue::TryEmplace(std::move(callable)) builds the task where it is stored.
+    template <typename Signature = std::int32_t(), typename FunctionType, typename... Args>
+    [[nodiscard]] auto PackageTask(FunctionType&& function, Args&&... args)
+    {
+        return detail::PackageTask<Signature>(detail::NoOptions{}, std::forward<FunctionType>(function), std::forward<Args>(args)...);
+    }
+
+    template <typename Signature = std::int32_t(), typename FunctionType, typename... Args>
+    [[nodiscard]] auto PackageTask(TaskOptions options, FunctionType&& function, Args&&... args)
+    {
+        return detail::PackageTask<Signature>(std::move(options), std::forward<FunctionType>(function), std::forward<Args>(args)...);
+    }
+
+    // Signature -> the signature of the produced task, see detail::TaskFactory.
+    // E.g. CreateTask<void(Context&)>(function, args...) -> the consumer calls task(context), which runs function(context, args...)
+    template <typename Signature = std::int32_t(), typename FunctionType, typename... Args>
+    [[nodiscard]] auto CreateTask(FunctionType&& function, Args&&... args)
+    {
+        auto&& [callable, future]{ PackageTask<Signature>(std::forward<FunctionType>(function), std::forward<Args>(args)...) };
+        return std::make_pair(Task<Signature>{ std::move(callable) }, std::move(future));
+    }
+
+    template <typename Signature = std::int32_t(), typename FunctionType, typename... Args>
+    [[nodiscard]] auto CreateTask(TaskOptions options, FunctionType&& function, Args&&... args)
+    {
+        auto&& [callable, future]{ PackageTask<Signature>(std::move(options), std::forward<FunctionType>(function), std::forward<Args>(args)...) };
+        return std::make_pair(Task<Signature>{ std::move(callable) }, std::move(future));
+    }
+
+    template <typename Signature = std::int32_t(), typename FunctionType, typename... Args>
+    [[nodiscard]] auto CreateTask(LightweightTag, FunctionType&& function, Args&&... args)
+    {
+        return detail::CreateLightweightTask<Signature>(detail::NoOptions{}, std::forward<FunctionType>(function), std::forward<Args>(args)...);
+    }
+
+    template <typename Signature = std::int32_t(), typename FunctionType, typename... Args>
+    [[nodiscard]] auto CreateTask(LightweightTag, TaskOptions options, FunctionType&& function, Args&&... args)
+    {
+        return detail::CreateLightweightTask<Signature>(std::move(options), std::forward<FunctionType>(function), std::forward<Args>(args)...);
+    }
+
+    // Tasks returning void rethrow the exception of the function, there is nowhere else to report it
+    template <typename Signature = std::int32_t(), typename FunctionType, typename... Args>
+    [[nodiscard]] auto CreateTask(DetachedTag, FunctionType&& function, Args&&... args)
+    {
+        return detail::CreateDetachedTask<Signature>(detail::NoOptions{}, std::forward<FunctionType>(function), std::forward<Args>(args)...);
+    }
+
+    template <typename Signature = std::int32_t(), typename FunctionType, typename... Args>
+    [[nodiscard]] auto CreateTask(DetachedTag, TaskOptions options, FunctionType&& function, Args&&... args)
+    {
+        return detail::CreateDetachedTask<Signature>(std::move(options), std::forward<FunctionType>(function), std::forward<Args>(args)...);
     }
-}
\ No newline at end of file
+}
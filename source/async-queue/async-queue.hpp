@@ -0,0 +1,348 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <utility>
+#include <cstdint>
+#include <optional>
+#include <coroutine>
+
+// Adds awaitable Push/Pop to any queue with the TryPush/TryPop/IsEmpty interface (LFQueue and its variants):
+// 
+//   co_await queue.Push(std::move(value));
+//   auto value{ co_await queue.Pop() };
+// 
+// A full/empty queue suspends the coroutine instead of failing, it doesn't block a thread or spin.
+// The waiters are intrusive nodes in the awaiters (i.e. in the coroutine frames) kept on two atomic stacks.
+// Whoever makes progress possible (a successful push/pop) completes the operation of a waiter on its behalf
+// and hands the coroutine to the scheduler (anything with Resume(std::coroutine_handle<>), e.g. executor::CoroutineScheduler).
+// The waiters of each side are served in FIFO order: one thread at a time moves them from the stack to a FIFO list,
+// the others only ask it for one more round, so the values of suspended pushers keep the order they arrived in.
+// Like in BlockingLFQueue, the uncontended path costs a fence and two loads on top of the underlying queue.
+template <typename Queue, typename Scheduler>
+class AsyncLFQueue
+{
+public:
+    using value_type = typename Queue::value_type;
+
+private:
+    struct Waiter
+    {
+        Waiter* Next{ nullptr };
+        std::coroutine_handle<> Handle{};
+        value_type* Value{ nullptr };              // the value to push
+        std::optional<value_type>* Result{ nullptr }; // the storage for the popped one
+    };
+
+    // New waiters go to the stack, the server moves them (oldest first) to the end of the list, only the server touches the list
+    struct alignas(std::hardware_destructive_interference_size) WaiterQueue
+    {
+        std::atomic<Waiter*> Stack{ nullptr };
+        std::atomic<Waiter*> Head{ nullptr }; // atomic only to be checked by Notify
+        Waiter* Tail{ nullptr };
+
+        [[nodiscard]] bool HasWaiters() const noexcept
+        {
+            return Stack.load(std::memory_order_relaxed) != nullptr || Head.load(std::memory_order_relaxed) != nullptr;
+        }
+    };
+
+public:
+    class PushAwaiter
+    {
+    public:
+        PushAwaiter(AsyncLFQueue& queue, value_type&& value) : 
+            mQueue{ queue },
+            mValue{ std::move(value) }
+        { }
+
+        [[nodiscard]] bool await_ready()
+        {
+            return mQueue.TryPush(mValue);
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            mWaiter.Handle = handle;
+            mWaiter.Value = &mValue;
+
+            mQueue.Suspend(mQueue.mPushWaiters, mWaiter); // the coroutine may already run on another thread after this
+        }
+
+        void await_resume() const noexcept
+        { }
+
+    private:
+        AsyncLFQueue& mQueue;
+        value_type mValue;
+        Waiter mWaiter;
+    };
+
+    class PopAwaiter
+    {
+    public:
+        explicit PopAwaiter(AsyncLFQueue& queue) : 
+            mQueue{ queue }
+        { }
+
+        [[nodiscard]] bool await_ready()
+        {
+            if (!mQueue.PopInto(mValue))
+            {
+                return false;
+            }
+
+            mQueue.Notify();
+            return true;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            mWaiter.Handle = handle;
+            mWaiter.Result = &mValue;
+
+            mQueue.Suspend(mQueue.mPopWaiters, mWaiter);
+        }
+
+        [[nodiscard]] value_type await_resume()
+        {
+            return std::move(*mValue);
+        }
+
+    private:
+        AsyncLFQueue& mQueue;
+        std::optional<value_type> mValue{}; // value_type doesn't have to be default-constructible
+        Waiter mWaiter;
+    };
+
+public:
+    template <typename... QueueArgs>
+    explicit AsyncLFQueue(Scheduler& scheduler, QueueArgs&&... queue_args) :
+        mScheduler{ scheduler },
+        mQueue{ std::forward<QueueArgs>(queue_args)... }
+    { }
+
+    // Suspended waiters are not resumed, their coroutines must be done (or destroyed) before the queue
+    ~AsyncLFQueue() noexcept = default;
+
+    AsyncLFQueue(const AsyncLFQueue& other) = delete;
+    AsyncLFQueue& operator=(const AsyncLFQueue& other) = delete;
+
+    [[nodiscard]] bool TryPush(value_type& value)
+    {
+        if (!mQueue.TryPush(value))
+        {
+            return false;
+        }
+
+        Notify();
+        return true;
+    }
+
+    [[nodiscard]] bool TryPop(value_type& value)
+    {
+        if (!mQueue.TryPop(value))
+        {
+            return false;
+        }
+
+        Notify();
+        return true;
+    }
+
+    [[nodiscard]] PushAwaiter Push(value_type value)
+    {
+        return PushAwaiter{ *this, std::move(value) };
+    }
+
+    [[nodiscard]] PopAwaiter Pop()
+    {
+        return PopAwaiter{ *this };
+    }
+
+    [[nodiscard]] inline bool IsEmpty() const noexcept
+    {
+        return mQueue.IsEmpty();
+    }
+
+private:
+    void Suspend(WaiterQueue& waiters, Waiter& waiter)
+    {
+        auto* head{ waiters.Stack.load(std::memory_order_relaxed) };
+        do
+        {
+            waiter.Next = head;
+        }
+        while (!waiters.Stack.compare_exchange_weak(head, &waiter, std::memory_order_release, std::memory_order_relaxed));
+
+        Notify(); // the value/space may have appeared between the failed attempt and the push
+    }
+
+    // Same protocol as EventCount: the side that made progress does fence -> check the waiters,
+    // a new waiter does push -> fence -> check the queue, at least one of them sees the other
+    void Notify()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!mPopWaiters.HasWaiters() && !mPushWaiters.HasWaiters())
+        {
+            return;
+        }
+
+        // somebody is serving -> it runs one more round for us
+        if (mServeRequests.fetch_add(1, std::memory_order_acq_rel) != 0)
+        {
+            return;
+        }
+
+        for (std::uint32_t requests{ 1 }; requests != 0;)
+        {
+            // a served pop frees a slot for a push waiter and vice versa
+            for (bool is_served{ true }; is_served;)
+            {
+                is_served = Serve(mPopWaiters, [this](Waiter& waiter) -> bool { return PopInto(*waiter.Result); });
+                is_served |= Serve(mPushWaiters, [this](Waiter& waiter) -> bool { return mQueue.TryPush(*waiter.Value); });
+            }
+
+            requests = mServeRequests.fetch_sub(requests, std::memory_order_acq_rel) - requests;
+        }
+    }
+
+    // Completes the waiters from the oldest one while the operation succeeds, the rest stay in the list.
+    // It never spins: once the waiters are visible (fence), a failed attempt means that the push/pop which would make
+    // the operation possible hasn't finished yet (e.g. a claimed but not committed slot) and its Notify serves them.
+    // Returns true if at least one waiter was resumed.
+    template <typename TryOperation>
+    bool Serve(WaiterQueue& waiters, TryOperation&& try_operation)
+    {
+        bool is_served{ false };
+
+        for (bool is_fenced{ false };;)
+        {
+            TakeWaiters(waiters);
+
+            auto* waiter{ waiters.Head.load(std::memory_order_relaxed) };
+            if (waiter == nullptr)
+            {
+                return is_served;
+            }
+
+            bool is_progress{ false };
+            while (waiter != nullptr && try_operation(*waiter))
+            {
+                auto* next{ waiter->Next };
+                mScheduler.Resume(waiter->Handle); // the frame (and the node) may be gone right after this
+
+                waiter = next;
+                is_served = is_progress = true;
+            }
+
+            waiters.Head.store(waiter, std::memory_order_relaxed);
+            if (waiter == nullptr)
+            {
+                waiters.Tail = nullptr;
+                is_fenced = false;
+                continue;
+            }
+
+            if (is_fenced && !is_progress)
+            {
+                return is_served;
+            }
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            is_fenced = true;
+        }
+    }
+
+    // Pops straight into the empty storage: with TryClaimRead (LFQueue) the value is moved out of its slot,
+    // other queues pop into a default-constructed value
+    [[nodiscard]] bool PopInto(std::optional<value_type>& result)
+    {
+        if constexpr (requires (Queue& queue) { queue.TryClaimRead(); })
+        {
+            auto handle{ mQueue.TryClaimRead() };
+            if (!handle)
+            {
+                return false;
+            }
+
+            result.emplace(std::move(*handle));
+        }
+        else
+        {
+            value_type value{};
+            if (!mQueue.TryPop(value))
+            {
+                return false;
+            }
+
+            result.emplace(std::move(value));
+        }
+
+        return true;
+    }
+
+    // Takes the whole stack (no ABA, nobody else can touch the taken nodes) and appends it to the list in arrival order
+    static void TakeWaiters(WaiterQueue& waiters) noexcept
+    {
+        auto* waiter{ waiters.Stack.exchange(nullptr, std::memory_order_acq_rel) };
+        if (waiter == nullptr)
+        {
+            return;
+        }
+
+        auto* last{ waiter };
+        Waiter* first{ nullptr };
+
+        while (waiter != nullptr)
+        {
+            auto* next{ waiter->Next };
+            waiter->Next = first;
+
+            first = waiter;
+            waiter = next;
+        }
+
+        if (waiters.Tail == nullptr)
+        {
+            waiters.Head.store(first, std::memory_order_relaxed);
+        }
+        else
+        {
+            waiters.Tail->Next = first;
+        }
+
+        waiters.Tail = last;
+    }
+
+private:
+    Scheduler& mScheduler;
+    Queue mQueue;
+
+    WaiterQueue mPopWaiters{};
+    WaiterQueue mPushWaiters{};
+
+    alignas(std::hardware_destructive_interference_size) std::atomic<std::uint32_t> mServeRequests{ 0 };
+};
@@ -0,0 +1,254 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+#include <lock-free-bounded-queue/lock-free-bounded-queue.hpp>
+#include <sharded-queue/sharded-queue.hpp>
+#include <unbounded-queue/unbounded-queue.hpp>
+#include <scq-queue/scq-queue.hpp>
+
+// Raw queue overhead: the payload does nothing, so every number below is the cost of the queue itself.
+// Machine-readable output: ./benchmarks --benchmark_out=results.json --benchmark_out_format=json
+
+constexpr static std::size_t ITEMS_PER_ITERATION{ 1 << 16 };
+
+template <std::size_t PayloadSize>
+struct Payload
+{
+    std::array<std::byte, PayloadSize> Data;
+};
+
+void SetCounters(benchmark::State& state, std::size_t operations)
+{
+    state.SetItemsProcessed(static_cast<std::int64_t>(operations));
+
+    state.counters["ops_per_sec"] = benchmark::Counter(static_cast<double>(operations), benchmark::Counter::kIsRate);
+    state.counters["ns_per_op"] = benchmark::Counter(static_cast<double>(operations) / 1e9, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+// One thread, TryPush followed by TryPop -> the uncontended cost of both operations
+template <typename Queue>
+void BM_TryPushTryPop(benchmark::State& state)
+{
+    Queue queue{};
+    typename Queue::value_type value{};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(queue.TryPush(value));
+        benchmark::DoNotOptimize(queue.TryPop(value));
+    }
+
+    SetCounters(state, 2 * static_cast<std::size_t>(state.iterations()));
+}
+
+// range(0) producers and range(1) consumers move ITEMS_PER_ITERATION payloads through the queue.
+// The threads are started once (outside the timed loop), an iteration only releases them for one round and waits for it.
+template <typename Queue>
+void BM_Throughput(benchmark::State& state)
+{
+    const auto producer_count{ static_cast<std::size_t>(state.range(0)) };
+    const auto consumer_count{ static_cast<std::size_t>(state.range(1)) };
+    const auto thread_count{ producer_count + consumer_count };
+
+    Queue queue{};
+
+    std::atomic<std::size_t> round{};
+    std::atomic<std::size_t> finished{};
+    std::atomic<std::size_t> consumed{};
+    std::atomic<bool> is_done{ false };
+
+    // work(round) for every round until is_done, the last thread to finish a round wakes the benchmark thread
+    auto run_rounds = [&](auto&& work) -> void
+    {
+        for (std::size_t current_round{ 1 };; ++current_round)
+        {
+            round.wait(current_round - 1, std::memory_order_acquire);
+            if (is_done.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            work(current_round);
+
+            if (finished.fetch_add(1, std::memory_order_acq_rel) + 1 == current_round * thread_count)
+            {
+                finished.notify_one();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads{};
+    threads.reserve(thread_count);
+
+    for (std::size_t i{}; i < consumer_count; ++i)
+    {
+        threads.emplace_back([&]() -> void
+        {
+            run_rounds([&](std::size_t current_round) -> void
+            {
+                typename Queue::value_type value{};
+                while (consumed.load(std::memory_order_relaxed) < current_round * ITEMS_PER_ITERATION)
+                {
+                    if (queue.TryPop(value))
+                    {
+                        consumed.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        });
+    }
+
+    for (std::size_t i{}; i < producer_count; ++i)
+    {
+        threads.emplace_back([&, i]() -> void
+        {
+            run_rounds([&](std::size_t) -> void
+            {
+                typename Queue::value_type value{};
+                for (std::size_t j{ i }; j < ITEMS_PER_ITERATION; j += producer_count)
+                {
+                    while (!queue.TryPush(value))
+                    { }
+                }
+            });
+        });
+    }
+
+    std::size_t current_round{};
+    for (auto _ : state)
+    {
+        round.store(++current_round, std::memory_order_release);
+        round.notify_all();
+
+        for (auto count{ finished.load(std::memory_order_acquire) }; count < current_round * thread_count; count = finished.load(std::memory_order_acquire))
+        {
+            finished.wait(count, std::memory_order_acquire);
+        }
+    }
+
+    is_done.store(true, std::memory_order_relaxed);
+    round.fetch_add(1, std::memory_order_release);
+    round.notify_all();
+
+    for (auto&& t : threads)
+    {
+        t.join();
+    }
+
+    SetCounters(state, ITEMS_PER_ITERATION * static_cast<std::size_t>(state.iterations()));
+}
+
+// Round trip through two queues: this thread sends, an echo thread sends the value back
+template <typename Queue>
+void BM_PingPong(benchmark::State& state)
+{
+    Queue requests{};
+    Queue responses{};
+
+    std::atomic<bool> is_done{ false };
+    std::thread echo{ [&]() -> void
+    {
+        typename Queue::value_type value{};
+        while (!is_done.load(std::memory_order_relaxed))
+        {
+            if (requests.TryPop(value))
+            {
+                while (!responses.TryPush(value))
+                { }
+            }
+        }
+    } };
+
+    typename Queue::value_type value{};
+    for (auto _ : state)
+    {
+        while (!requests.TryPush(value))
+        { }
+
+        while (!responses.TryPop(value))
+        { }
+    }
+
+    is_done.store(true, std::memory_order_relaxed);
+    echo.join();
+
+    // a round trip is two messages
+    SetCounters(state, 2 * static_cast<std::size_t>(state.iterations()));
+    state.counters["round_trip_ns"] = benchmark::Counter(static_cast<double>(state.iterations()) / 1e9, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+void ThreadSweep(benchmark::internal::Benchmark* benchmark)
+{
+    for (std::int64_t threads : { 1, 2, 4, 8, 16 })
+    {
+        benchmark->Args({ threads, threads });
+    }
+
+    benchmark->Args({ 1, 4 })->Args({ 4, 1 })->Args({ 16, 1 })->Args({ 1, 16 });
+}
+
+// Payload sizes
+BENCHMARK(BM_TryPushTryPop<LFQueue<Payload<1>, 1'024>>);
+BENCHMARK(BM_TryPushTryPop<LFQueue<Payload<8>, 1'024>>);
+BENCHMARK(BM_TryPushTryPop<LFQueue<Payload<64>, 1'024>>);
+BENCHMARK(BM_TryPushTryPop<LFQueue<Payload<256>, 1'024>>);
+BENCHMARK(BM_TryPushTryPop<LFTaskQueue<1'024>>);
+
+// Concurrency policies
+BENCHMARK(BM_TryPushTryPop<SPSCQueue<Payload<8>, 1'024>>);
+BENCHMARK(BM_TryPushTryPop<MPSCQueue<Payload<8>, 1'024>>);
+BENCHMARK(BM_TryPushTryPop<SPMCQueue<Payload<8>, 1'024>>);
+BENCHMARK(BM_TryPushTryPop<UnboundedLFQueue<Payload<8>, 1'024>>);
+BENCHMARK(BM_TryPushTryPop<SCQueue<Payload<8>, 1'024>>);
+
+// Queue sizes and producer/consumer counts
+BENCHMARK(BM_Throughput<LFQueue<Payload<8>, 64>>)->Apply(ThreadSweep)->UseRealTime();
+BENCHMARK(BM_Throughput<LFQueue<Payload<8>, 1'024>>)->Apply(ThreadSweep)->UseRealTime();
+BENCHMARK(BM_Throughput<LFQueue<Payload<8>, 16'384>>)->Apply(ThreadSweep)->UseRealTime();
+BENCHMARK(BM_Throughput<LFQueue<Payload<64>, 1'024>>)->Apply(ThreadSweep)->UseRealTime();
+
+// Padded vs packed layout
+BENCHMARK(BM_Throughput<LFPackedQueue<Payload<8>, 1'024>>)->Apply(ThreadSweep)->UseRealTime();
+
+// One head/tail pair vs 8 shards with the same total capacity
+BENCHMARK(BM_Throughput<ShardedLFQueue<Payload<8>, 128, 8>>)->Apply(ThreadSweep)->Args({ 32, 32 })->UseRealTime();
+
+// Linked segments, never full
+BENCHMARK(BM_Throughput<UnboundedLFQueue<Payload<8>, 1'024>>)->Apply(ThreadSweep)->UseRealTime();
+
+// CAS retry loops vs fetch_add rings (SCQ) at high thread counts
+BENCHMARK(BM_Throughput<LFQueue<Payload<8>, 1'024>>)->Args({ 32, 32 })->UseRealTime();
+BENCHMARK(BM_Throughput<SCQueue<Payload<8>, 1'024>>)->Apply(ThreadSweep)->Args({ 32, 32 })->UseRealTime();
+
+BENCHMARK(BM_Throughput<SPSCQueue<Payload<8>, 1'024>>)->Args({ 1, 1 })->UseRealTime();
+
+// Round trip latency
+BENCHMARK(BM_PingPong<LFQueue<Payload<8>, 1'024>>)->UseRealTime();
+BENCHMARK(BM_PingPong<SPSCQueue<Payload<8>, 1'024>>)->UseRealTime();
@@ -0,0 +1,142 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <chrono>
+#include <utility>
+#include <cstdint>
+
+#include <event-count/event-count.hpp>
+
+// Adds blocking Push/Pop to any queue with the TryPush/TryPop interface (LFQueue and its variants).
+// A blocked call spins briefly and then parks on an event count, the opposite side wakes it only if someone sleeps,
+// so the uncontended path stays lock-free and makes no syscalls.
+template <typename Queue>
+class BlockingLFQueue
+{
+    constexpr static std::uint32_t MAX_SPIN_PAUSES{ 1 << 10 };
+
+public:
+    using value_type = typename Queue::value_type;
+
+public:
+    template <typename... QueueArgs>
+    explicit BlockingLFQueue(QueueArgs&&... queue_args) :
+        mQueue{ std::forward<QueueArgs>(queue_args)... }
+    { }
+
+    ~BlockingLFQueue() noexcept = default;
+
+    [[nodiscard]] bool TryPush(value_type& value)
+    {
+        if (!mQueue.TryPush(value))
+        {
+            return false;
+        }
+
+        mNotEmpty.Notify();
+        return true;
+    }
+
+    [[nodiscard]] bool TryPop(value_type& value)
+    {
+        if (!mQueue.TryPop(value))
+        {
+            return false;
+        }
+
+        mNotFull.Notify();
+        return true;
+    }
+
+    void Push(value_type& value)
+    {
+        Await(mNotFull, [&]() -> bool { return TryPush(value); });
+    }
+
+    void Pop(value_type& value)
+    {
+        Await(mNotEmpty, [&]() -> bool { return TryPop(value); });
+    }
+
+    template <typename Rep, typename Period>
+    [[nodiscard]] bool PopFor(value_type& value, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        return PopUntil(value, std::chrono::steady_clock::now() + timeout);
+    }
+
+    template <typename Clock, typename Duration>
+    [[nodiscard]] bool PopUntil(value_type& value, const std::chrono::time_point<Clock, Duration>& deadline)
+    {
+        return Await(mNotEmpty, [&]() -> bool { return TryPop(value); }, &deadline);
+    }
+
+    [[nodiscard]] inline bool IsEmpty() const noexcept
+    {
+        return mQueue.IsEmpty();
+    }
+
+private:
+    template <typename TryOperation, typename TimePoint = std::chrono::steady_clock::time_point>
+    bool Await(synchronization::EventCount& event, TryOperation&& try_operation, const TimePoint* deadline = nullptr)
+    {
+        // exponential backoff: 1, 2, 4 ... pauses between attempts
+        for (std::uint32_t pauses{ 1 }; pauses <= MAX_SPIN_PAUSES; pauses *= 2)
+        {
+            if (try_operation())
+            {
+                return true;
+            }
+
+            for (std::uint32_t i{}; i < pauses; ++i)
+            {
+                synchronization::CpuRelax();
+            }
+        }
+
+        for (;;)
+        {
+            auto key{ event.PrepareWait() };
+            if (try_operation())
+            {
+                event.CancelWait();
+                return true;
+            }
+
+            if (deadline == nullptr)
+            {
+                event.Wait(key);
+            }
+            else if (!event.WaitUntil(key, *deadline))
+            {
+                return try_operation();
+            }
+        }
+    }
+
+private:
+    Queue mQueue;
+
+    alignas(std::hardware_destructive_interference_size) synchronization::EventCount mNotEmpty;
+    alignas(std::hardware_destructive_interference_size) synchronization::EventCount mNotFull;
+};
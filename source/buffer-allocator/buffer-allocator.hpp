@@ -0,0 +1,172 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <cerrno>
+#include <vector>
+#include <cstddef>
+#include <system_error>
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <linux/mempolicy.h>
+#endif
+
+// Allocators for queue buffers whose capacity is chosen at runtime.
+// Interface: Allocate(bytes, alignment) -> void* (throws std::bad_alloc), Deallocate(pointer, bytes, alignment) noexcept
+namespace memory
+{
+    class DefaultBufferAllocator
+    {
+    public:
+        [[nodiscard]] void* Allocate(std::size_t bytes, std::size_t alignment)
+        {
+            return ::operator new(bytes, std::align_val_t{ alignment });
+        }
+
+        void Deallocate(void* pointer, std::size_t bytes, std::size_t alignment) noexcept
+        {
+            ::operator delete(pointer, bytes, std::align_val_t{ alignment });
+        }
+    };
+
+#if defined(__linux__)
+    // Maps the buffer with 2 MB pages: explicit hugetlbfs pages when they are reserved (vm.nr_hugepages),
+    // otherwise a 2 MB aligned mapping advised for transparent huge pages.
+    // The pages can be bound to one NUMA node: Allocate throws std::system_error if the binding fails (e.g. there is no such node),
+    // it is only skipped where the kernel doesn't support NUMA at all (ENOSYS).
+    class HugePageAllocator
+    {
+    public:
+        constexpr static std::size_t HUGE_PAGE_SIZE{ 2 * 1'024 * 1'024 };
+        constexpr static int ANY_NODE{ -1 };
+
+    public:
+        explicit HugePageAllocator(int numa_node = ANY_NODE) noexcept :
+            mNumaNode{ numa_node }
+        { }
+
+        [[nodiscard]] void* Allocate(std::size_t bytes, [[maybe_unused]] std::size_t alignment)
+        {
+            const auto mapping_size{ RoundUp(bytes) };
+
+            void* pointer{ ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0) };
+            if (pointer == MAP_FAILED)
+            {
+                pointer = MapAligned(mapping_size);
+                ::madvise(pointer, mapping_size, MADV_HUGEPAGE);
+            }
+
+            // before the first touch, so the pages are faulted in on the right node
+            if (const auto error{ BindToNode(pointer, mapping_size) }; error != 0)
+            {
+                ::munmap(pointer, mapping_size);
+                throw std::system_error{ error, std::system_category(), "HugePageAllocator: mbind" };
+            }
+
+            return pointer;
+        }
+
+        void Deallocate(void* pointer, std::size_t bytes, [[maybe_unused]] std::size_t alignment) noexcept
+        {
+            ::munmap(pointer, RoundUp(bytes));
+        }
+
+        [[nodiscard]] inline int NumaNode() const noexcept
+        {
+            return mNumaNode;
+        }
+
+    private:
+        [[nodiscard]] constexpr static std::size_t RoundUp(std::size_t bytes) noexcept
+        {
+            return (bytes + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        }
+
+        // Over-allocates by one huge page and trims the unaligned head and tail
+        [[nodiscard]] static void* MapAligned(std::size_t mapping_size)
+        {
+            const auto reserved_size{ mapping_size + HUGE_PAGE_SIZE };
+
+            void* reserved{ ::mmap(nullptr, reserved_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+            if (reserved == MAP_FAILED)
+            {
+                throw std::bad_alloc{};
+            }
+
+            auto* begin{ static_cast<std::byte*>(reserved) };
+            auto* aligned{ reinterpret_cast<std::byte*>(RoundUp(reinterpret_cast<std::size_t>(begin))) };
+
+            const auto head_size{ static_cast<std::size_t>(aligned - begin) };
+            const auto tail_size{ reserved_size - head_size - mapping_size };
+
+            if (head_size != 0)
+            {
+                ::munmap(begin, head_size);
+            }
+
+            if (tail_size != 0)
+            {
+                ::munmap(aligned + mapping_size, tail_size);
+            }
+
+            return aligned;
+        }
+
+        // Returns errno of a failed binding, 0 if the pages are bound (or no node was requested, or NUMA isn't supported)
+        [[nodiscard]] int BindToNode(void* pointer, std::size_t mapping_size) const
+        {
+            constexpr std::size_t WORD_BITS{ sizeof(unsigned long) * 8 };
+
+            if (mNumaNode == ANY_NODE)
+            {
+                return 0;
+            }
+
+            if (mNumaNode < 0)
+            {
+                return EINVAL;
+            }
+
+            const auto node{ static_cast<std::size_t>(mNumaNode) };
+
+            std::vector<unsigned long> node_mask(node / WORD_BITS + 1);
+            node_mask[node / WORD_BITS] = 1UL << (node % WORD_BITS);
+
+            // the kernel expects maxnode + 1
+            if (::syscall(SYS_mbind, pointer, mapping_size, MPOL_BIND, node_mask.data(), std::size(node_mask) * WORD_BITS + 1, 0) == -1)
+            {
+                return errno == ENOSYS ? 0 : errno;
+            }
+
+            return 0;
+        }
+
+    private:
+        int mNumaNode;
+    };
+#endif
+}
@@ -0,0 +1,244 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <utility>
+#include <unordered_map>
+
+#include <pool-allocator/pool-allocator.hpp>
+
+namespace cancellation
+{
+    namespace detail
+    {
+        // A cancellation epoch shared by a source/group and its tokens: cancelling bumps the epoch,
+        // a token is cancelled once the epoch differs from the one it has captured
+        class State
+        {
+        public:
+            State() noexcept = default;
+
+            State(const State& other) = delete;
+            State& operator=(const State& other) = delete;
+
+            [[nodiscard]] static void* operator new(std::size_t bytes)
+            {
+                return memory::PoolAllocator{}.Allocate(bytes, alignof(State));
+            }
+
+            static void operator delete(void* pointer, std::size_t bytes) noexcept
+            {
+                memory::PoolAllocator{}.Deallocate(pointer, bytes, alignof(State));
+            }
+
+            [[nodiscard]] inline std::uint64_t Epoch() const noexcept
+            {
+                return mEpoch.load(std::memory_order_acquire);
+            }
+
+            void Cancel() noexcept
+            {
+                mEpoch.fetch_add(1, std::memory_order_acq_rel);
+            }
+
+            void Acquire() noexcept
+            {
+                mReferences.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void Release() noexcept
+            {
+                if (mReferences.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    delete this;
+                }
+            }
+
+        private:
+            std::atomic<std::uint64_t> mEpoch{};
+            std::atomic<std::uint32_t> mReferences{ 1 };
+        };
+    }
+
+    // Checked by a task before it runs, IsCancelled() is one atomic load. A default token is never cancelled.
+    class CancellationToken
+    {
+    public:
+        CancellationToken() noexcept = default;
+
+        // Takes over one reference to the state
+        CancellationToken(detail::State* state, std::uint64_t epoch) noexcept : 
+            mState{ state },
+            mEpoch{ epoch }
+        { }
+
+        ~CancellationToken() noexcept
+        {
+            if (mState != nullptr)
+            {
+                mState->Release();
+            }
+        }
+
+        CancellationToken(const CancellationToken& other) noexcept : 
+            mState{ other.mState },
+            mEpoch{ other.mEpoch }
+        {
+            if (mState != nullptr)
+            {
+                mState->Acquire();
+            }
+        }
+
+        CancellationToken(CancellationToken&& other) noexcept : 
+            mState{ std::exchange(other.mState, nullptr) },
+            mEpoch{ other.mEpoch }
+        { }
+
+        CancellationToken& operator=(CancellationToken other) noexcept
+        {
+            std::swap(mState, other.mState);
+            std::swap(mEpoch, other.mEpoch);
+
+            return *this;
+        }
+
+        [[nodiscard]] inline bool IsCancelled() const noexcept
+        {
+            return mState != nullptr && mState->Epoch() != mEpoch;
+        }
+
+    private:
+        detail::State* mState{ nullptr };
+        std::uint64_t mEpoch{};
+    };
+
+    // One-shot: Cancel() cancels every token of the source, including the ones taken afterwards
+    class CancellationSource
+    {
+    public:
+        CancellationSource() : 
+            mState{ new detail::State{} }
+        { }
+
+        ~CancellationSource() noexcept
+        {
+            mState->Release();
+        }
+
+        CancellationSource(const CancellationSource& other) = delete;
+        CancellationSource& operator=(const CancellationSource& other) = delete;
+
+        [[nodiscard]] CancellationToken GetToken() const noexcept
+        {
+            mState->Acquire();
+            return CancellationToken{ mState, 0 };
+        }
+
+        void Cancel() noexcept
+        {
+            mState->Cancel();
+        }
+
+        [[nodiscard]] inline bool IsCancelled() const noexcept
+        {
+            return mState->Epoch() != 0;
+        }
+
+    private:
+        detail::State* mState;
+    };
+
+    // Bulk cancellation by group id: Cancel(group) cancels the tokens taken for the group so far,
+    // the tokens taken afterwards are valid again (e.g. the next batch of a client which has timed out).
+    // Token() locks a mutex, take one token per batch rather than per task.
+    class CancellationRegistry
+    {
+    public:
+        using group_id = std::uint64_t;
+
+    public:
+        CancellationRegistry() = default;
+
+        ~CancellationRegistry() noexcept
+        {
+            for (auto&& [group, state] : mGroups)
+            {
+                state->Release();
+            }
+        }
+
+        CancellationRegistry(const CancellationRegistry& other) = delete;
+        CancellationRegistry& operator=(const CancellationRegistry& other) = delete;
+
+        [[nodiscard]] CancellationToken Token(group_id group)
+        {
+            std::lock_guard<std::mutex> lock{ mMutex };
+
+            auto it{ mGroups.find(group) };
+            if (it == std::end(mGroups))
+            {
+                // allocated before the insertion -> a failed allocation leaves no null entry in the map
+                auto state{ std::make_unique<detail::State>() };
+
+                it = mGroups.try_emplace(group, state.get()).first;
+                state.release();
+            }
+
+            auto* state{ it->second };
+
+            state->Acquire();
+            return CancellationToken{ state, state->Epoch() };
+        }
+
+        void Cancel(group_id group)
+        {
+            std::lock_guard<std::mutex> lock{ mMutex };
+
+            if (auto it{ mGroups.find(group) }; it != std::end(mGroups))
+            {
+                it->second->Cancel();
+            }
+        }
+
+        // Drops the state of the group, its outstanding tokens keep working
+        void Remove(group_id group)
+        {
+            std::lock_guard<std::mutex> lock{ mMutex };
+
+            if (auto it{ mGroups.find(group) }; it != std::end(mGroups))
+            {
+                it->second->Release();
+                mGroups.erase(it);
+            }
+        }
+
+    private:
+        std::mutex mMutex;
+        std::unordered_map<group_id, detail::State*> mGroups;
+    };
+}
@@ -0,0 +1,213 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <exception>
+#include <coroutine>
+
+#include <event-count/event-count.hpp>
+#include <lock-free-bounded-queue/lock-free-bounded-queue.hpp>
+
+namespace executor
+{
+    // Return type for coroutines nobody waits for: starts right away, the frame frees itself at the end.
+    // An exception escaping the coroutine terminates, there is nobody to report it to.
+    struct DetachedCoroutine
+    {
+        struct promise_type
+        {
+            DetachedCoroutine get_return_object() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void return_void() noexcept
+            { }
+
+            void unhandled_exception() noexcept
+            {
+                std::terminate();
+            }
+        };
+    };
+
+    // Runs coroutines on a fixed set of threads: the run queue is an MPMC LFQueue of coroutine handles,
+    // so resuming a coroutine costs one push and one pop, nothing is allocated. Idle workers park on an event count.
+    template <std::size_t RunQueueSize = 4'096>
+    class CoroutineScheduler
+    {
+    public:
+        using handle_t = std::coroutine_handle<>;
+
+        class ScheduleAwaiter
+        {
+        public:
+            explicit ScheduleAwaiter(CoroutineScheduler& scheduler) noexcept : 
+                mScheduler{ scheduler }
+            { }
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(handle_t handle) noexcept
+            {
+                mScheduler.Resume(handle);
+            }
+
+            void await_resume() const noexcept
+            { }
+
+        private:
+            CoroutineScheduler& mScheduler;
+        };
+
+    public:
+        explicit CoroutineScheduler(std::size_t thread_count = std::thread::hardware_concurrency())
+        {
+            thread_count = std::max(thread_count, std::size_t{ 1 });
+
+            mWorkers.reserve(thread_count);
+            for (std::size_t i{}; i < thread_count; ++i)
+            {
+                mWorkers.emplace_back(&CoroutineScheduler::Run, this);
+            }
+        }
+
+        ~CoroutineScheduler() noexcept
+        {
+            Shutdown();
+        }
+
+        CoroutineScheduler(const CoroutineScheduler& other) = delete;
+        CoroutineScheduler& operator=(const CoroutineScheduler& other) = delete;
+
+        // co_await scheduler.Schedule() -> the rest of the coroutine runs on a worker
+        [[nodiscard]] ScheduleAwaiter Schedule() noexcept
+        {
+            return ScheduleAwaiter{ *this };
+        }
+
+        // Queues a suspended coroutine to be resumed by a worker
+        void Resume(handle_t handle) noexcept
+        {
+            while (!mRunQueue.TryPush(handle))
+            {
+                if (tCurrentScheduler == this) // a worker waiting for space could wait forever, resume right away instead
+                {
+                    handle.resume();
+                    return;
+                }
+
+                std::this_thread::yield();
+            }
+
+            mWorkAvailable.Notify();
+        }
+
+        // Graceful: the workers resume everything queued (including the coroutines queued meanwhile) and exit.
+        // Coroutines still suspended on something else (e.g. an AsyncLFQueue) are never resumed.
+        void Shutdown() noexcept
+        {
+            if (mIsStopping.exchange(true, std::memory_order_acq_rel))
+            {
+                return;
+            }
+
+            mWorkAvailable.NotifyAll();
+
+            for (auto&& worker : mWorkers)
+            {
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
+            }
+        }
+
+        [[nodiscard]] inline std::size_t ThreadCount() const noexcept
+        {
+            return std::size(mWorkers);
+        }
+
+    private:
+        void Run() noexcept
+        {
+            tCurrentScheduler = this;
+            handle_t handle{};
+
+            for (;;)
+            {
+                if (mRunQueue.TryPop(handle))
+                {
+                    handle.resume();
+                    continue;
+                }
+
+                auto key{ mWorkAvailable.PrepareWait() };
+                if (mRunQueue.TryPop(handle))
+                {
+                    mWorkAvailable.CancelWait();
+
+                    handle.resume();
+                    continue;
+                }
+
+                if (mIsStopping.load(std::memory_order_acquire))
+                {
+                    mWorkAvailable.CancelWait();
+                    break;
+                }
+
+                mWorkAvailable.Wait(key);
+            }
+
+            tCurrentScheduler = nullptr;
+        }
+
+    private:
+        inline static thread_local CoroutineScheduler* tCurrentScheduler{ nullptr };
+
+        std::vector<std::thread> mWorkers;
+        LFQueue<handle_t, RunQueueSize> mRunQueue;
+
+        alignas(std::hardware_destructive_interference_size) synchronization::EventCount mWorkAvailable;
+        alignas(std::hardware_destructive_interference_size) std::atomic<bool> mIsStopping{ false };
+    };
+}
@@ -0,0 +1,166 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstdint>
+#include <climits>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+#endif
+
+#if defined(__linux__)
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <ctime>
+#endif
+
+namespace synchronization
+{
+    inline void CpuRelax() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    // Lets a thread sleep until some condition, checked by the caller, may have changed:
+    // 
+    //   auto key{ event.PrepareWait() };
+    //   if (condition()) { event.CancelWait(); } else { event.Wait(key); }
+    // 
+    // Notify() is a fence + a load while nobody sleeps, the epoch is bumped and the sleepers are woken only when there are any.
+    class EventCount
+    {
+        static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "the epoch is used as a futex word");
+
+    public:
+        EventCount() noexcept = default;
+
+        EventCount(const EventCount& other) = delete;
+        EventCount& operator=(const EventCount& other) = delete;
+
+        [[nodiscard]] std::uint32_t PrepareWait() noexcept
+        {
+            mWaiters.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            return mEpoch.load(std::memory_order_seq_cst);
+        }
+
+        void CancelWait() noexcept
+        {
+            mWaiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        void Wait(std::uint32_t key) noexcept
+        {
+            while (mEpoch.load(std::memory_order_acquire) == key)
+            {
+#if defined(__linux__)
+                Futex(FUTEX_WAIT_PRIVATE, key, nullptr);
+#else
+                mEpoch.wait(key, std::memory_order_acquire);
+#endif
+            }
+
+            CancelWait();
+        }
+
+        // Returns false if the deadline has passed before a notification
+        template <typename Clock, typename Duration>
+        [[nodiscard]] bool WaitUntil(std::uint32_t key, const std::chrono::time_point<Clock, Duration>& deadline) noexcept
+        {
+            while (mEpoch.load(std::memory_order_acquire) == key)
+            {
+                const auto remaining{ std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Clock::now()) };
+                if (remaining <= std::chrono::nanoseconds::zero())
+                {
+                    CancelWait();
+                    return false;
+                }
+
+#if defined(__linux__)
+                const auto seconds{ std::chrono::duration_cast<std::chrono::seconds>(remaining) };
+
+                timespec timeout{};
+                timeout.tv_sec = static_cast<std::time_t>(seconds.count());
+                timeout.tv_nsec = static_cast<long>((remaining - seconds).count());
+
+                Futex(FUTEX_WAIT_PRIVATE, key, &timeout);
+#else
+                std::this_thread::sleep_for(std::min(remaining, std::chrono::nanoseconds{ 100'000 })); // no timed atomic wait -> poll
+#endif
+            }
+
+            CancelWait();
+            return true;
+        }
+
+        void Notify() noexcept
+        {
+            Notify(1);
+        }
+
+        void NotifyAll() noexcept
+        {
+            Notify(INT_MAX);
+        }
+
+    private:
+        void Notify(int count) noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (mWaiters.load(std::memory_order_seq_cst) == 0)
+            {
+                return;
+            }
+
+            mEpoch.fetch_add(1, std::memory_order_seq_cst);
+
+#if defined(__linux__)
+            Futex(FUTEX_WAKE_PRIVATE, static_cast<std::uint32_t>(count), nullptr);
+#else
+            count == 1 ? mEpoch.notify_one() : mEpoch.notify_all();
+#endif
+        }
+
+#if defined(__linux__)
+        void Futex(int operation, std::uint32_t value, const timespec* timeout) noexcept
+        {
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&mEpoch), operation, value, timeout, nullptr, 0);
+        }
+#endif
+
+    private:
+        std::atomic<std::uint32_t> mEpoch{};
+        std::atomic<std::uint32_t> mWaiters{};
+    };
+}
@@ -0,0 +1,159 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <cstddef>
+#include <algorithm>
+
+namespace memory
+{
+    // Hazard pointers: before dereferencing a shared node a thread publishes its address in a hazard slot,
+    // a retired node is only reused/freed once no slot refers to it (this also rules out ABA on the node).
+    // A Guard owns SlotCount slots for the duration of one operation, up to MaxGuards guards can be alive at once.
+    template <std::size_t SlotCount = 2, std::size_t MaxGuards = 128>
+    class HazardDomain
+    {
+        struct alignas(std::hardware_destructive_interference_size) Record
+        {
+            std::atomic<bool> IsActive{ false };
+            std::array<std::atomic<const void*>, SlotCount> Hazards{};
+        };
+
+    public:
+        constexpr static std::size_t HAZARD_COUNT{ SlotCount * MaxGuards };
+
+        using hazards_t = std::array<const void*, HAZARD_COUNT>;
+
+        class Guard
+        {
+        public:
+            explicit Guard(HazardDomain& domain) noexcept :
+                mRecord{ &domain.AcquireRecord() }
+            { }
+
+            ~Guard() noexcept
+            {
+                for (auto& hazard : mRecord->Hazards)
+                {
+                    hazard.store(nullptr, std::memory_order_release);
+                }
+
+                mRecord->IsActive.store(false, std::memory_order_release);
+            }
+
+            Guard(const Guard& other) = delete;
+            Guard& operator=(const Guard& other) = delete;
+
+            // Loads source and publishes it in the slot, the returned pointer stays valid until the slot is changed
+            template <typename T>
+            [[nodiscard]] T* Protect(std::size_t slot, const std::atomic<T*>& source) noexcept
+            {
+                auto* pointer{ source.load(std::memory_order_acquire) };
+
+                for (;;)
+                {
+                    mRecord->Hazards[slot].store(pointer, std::memory_order_seq_cst);
+
+                    // still reachable after the publication -> a reclaimer which removed it later will see our hazard
+                    auto* reloaded{ source.load(std::memory_order_seq_cst) };
+                    if (reloaded == pointer)
+                    {
+                        return pointer;
+                    }
+
+                    pointer = reloaded;
+                }
+            }
+
+            void Clear(std::size_t slot) noexcept
+            {
+                mRecord->Hazards[slot].store(nullptr, std::memory_order_release);
+            }
+
+        private:
+            Record* mRecord;
+        };
+
+    public:
+        HazardDomain() = default;
+        ~HazardDomain() noexcept = default;
+
+        HazardDomain(const HazardDomain& other) = delete;
+        HazardDomain& operator=(const HazardDomain& other) = delete;
+
+        // Must be called after the retired nodes were unlinked, returns the number of hazards in the sorted prefix
+        [[nodiscard]] std::size_t CollectHazards(hazards_t& hazards) const noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            std::size_t count{};
+            for (const auto& record : mRecords)
+            {
+                for (const auto& hazard : record.Hazards)
+                {
+                    if (auto* pointer{ hazard.load(std::memory_order_seq_cst) }; pointer != nullptr)
+                    {
+                        hazards[count++] = pointer;
+                    }
+                }
+            }
+
+            std::sort(std::begin(hazards), std::begin(hazards) + static_cast<std::ptrdiff_t>(count));
+            return count;
+        }
+
+        [[nodiscard]] static bool IsHazard(const hazards_t& hazards, std::size_t count, const void* pointer) noexcept
+        {
+            return std::binary_search(std::begin(hazards), std::begin(hazards) + static_cast<std::ptrdiff_t>(count), pointer);
+        }
+
+    private:
+        // Every thread starts looking at its own record, so guards of different threads rarely touch the same line
+        [[nodiscard]] Record& AcquireRecord() noexcept
+        {
+            static std::atomic<std::size_t> thread_counter{};
+            thread_local const std::size_t first_record{ thread_counter.fetch_add(1, std::memory_order_relaxed) };
+
+            for (std::size_t i{};; ++i)
+            {
+                auto& record{ mRecords[(first_record + i) % MaxGuards] };
+                if (!record.IsActive.load(std::memory_order_relaxed) && !record.IsActive.exchange(true, std::memory_order_acquire))
+                {
+                    return record;
+                }
+
+                if ((i + 1) % MaxGuards == 0) // more than MaxGuards guards are alive
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+    private:
+        std::array<Record, MaxGuards> mRecords{};
+    };
+}
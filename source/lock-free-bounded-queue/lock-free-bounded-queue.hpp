@@ -27,115 +27,728 @@
 #include <atomic>
 #include <bit>
 #include <array>
+#include <span>
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <exception>
+#include <type_traits>
 
 #include <abstract-task/abstract-task.hpp>
+#include <buffer-allocator/buffer-allocator.hpp>
+#include <queue-stats/queue-stats.hpp>
 
-template <std::size_t Size>
+// Which ends of the queue may be used by more than one thread at a time
+namespace concurrency
+{
+    struct MPMC { constexpr static bool MULTI_PRODUCER{ true };  constexpr static bool MULTI_CONSUMER{ true };  };
+    struct MPSC { constexpr static bool MULTI_PRODUCER{ true };  constexpr static bool MULTI_CONSUMER{ false }; };
+    struct SPMC { constexpr static bool MULTI_PRODUCER{ false }; constexpr static bool MULTI_CONSUMER{ true };  };
+    struct SPSC { constexpr static bool MULTI_PRODUCER{ false }; constexpr static bool MULTI_CONSUMER{ false }; };
+}
+
+// How nodes are laid out in the buffer
+namespace layout
+{
+    // every node takes its own cache line -> no false sharing, but a 64-byte footprint per slot
+    struct Padded { constexpr static bool PACKED{ false }; };
+
+    // nodes are packed several per line and consecutive positions are spread across lines (as in atomic_queue)
+    struct Packed { constexpr static bool PACKED{ true }; };
+
+    // Packed remap: index i goes to line i % line_count, column i / line_count (line_mask = line_count - 1, column_shift = log2(line_count))
+    [[nodiscard]] constexpr std::size_t PackedIndex(std::size_t index, std::size_t line_mask, std::size_t column_shift, std::size_t slots_per_line) noexcept
+    {
+        return (index & line_mask) * slots_per_line + (index >> column_shift);
+    }
+}
+
+// Size == std::dynamic_extent -> the capacity is passed to the constructor and the buffer is taken from Allocator
+// Stats -> queue_stats::NoStats (compiled out) or queue_stats::QueueStats (per-thread counters + sojourn histogram)
+template <typename T, std::size_t Size, typename Concurrency = concurrency::MPMC, typename Allocator = memory::DefaultBufferAllocator, typename Layout = layout::Padded, typename Stats = queue_stats::NoStats>
 class LFQueue
 {
-    static_assert(Size > 2, "Size must be > 2");
-    static_assert(std::has_single_bit(Size), "Size must be power of two");
+    constexpr static bool IS_DYNAMIC{ Size == std::dynamic_extent };
+
+    static_assert(IS_DYNAMIC || Size > 2, "Size must be > 2");
+    static_assert(IS_DYNAMIC || std::has_single_bit(Size), "Size must be power of two");
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>, "T must be nothrow movable (TryPop move-assigns into the output)");
 
     [[nodiscard("Warning: more than 1 MB is allocated on the stack!")]] bool stack_allocation_warning() { return true; }
 
-public:
-    using abstract_task_t = abstract_task::Task<std::int32_t()>; // default return type -> 32-bit integer
+    constexpr static bool MULTI_PRODUCER{ Concurrency::MULTI_PRODUCER };
+    constexpr static bool MULTI_CONSUMER{ Concurrency::MULTI_CONSUMER };
+
+    // SPSC doesn't need per-node sequences, each side only publishes its own index and caches the remote one
+    constexpr static bool USE_CACHED_INDICES{ !MULTI_PRODUCER && !MULTI_CONSUMER };
 
 public:
-    LFQueue() : 
-        mBufferMask{ Size - 1 }
+    using value_type = T;
+
+    // A claimed free slot: the value is constructed in place (Emplace) and published by Commit.
+    // The slot can't be handed back, every later position would wait for it, so like std::thread
+    // a handle destroyed while it still owns a slot (not committed) calls std::terminate.
+    class WriteHandle
     {
-        if constexpr (sizeof(Node) * Size > sizeof(std::byte) * 1'024 * 1'024)
+        friend class LFQueue;
+
+    public:
+        WriteHandle() noexcept = default;
+
+        ~WriteHandle() noexcept
         {
-            stack_allocation_warning();
+            if (mQueue != nullptr)
+            {
+                std::terminate();
+            }
         }
 
-        mHead.store(0, std::memory_order_relaxed);
-        mTail.store(0, std::memory_order_relaxed);
+        WriteHandle(const WriteHandle& other) = delete;
+        WriteHandle& operator=(const WriteHandle& other) = delete;
 
-        for (std::size_t i{}; i < Size; ++i)
+        WriteHandle(WriteHandle&& other) noexcept :
+            mQueue{ std::exchange(other.mQueue, nullptr) },
+            mPosition{ other.mPosition },
+            mIsConstructed{ other.mIsConstructed }
+        { }
+
+        WriteHandle& operator=(WriteHandle&& other) noexcept
         {
-            mBuffer[i].Sequence.store(i, std::memory_order_relaxed);
+            if (this != &other)
+            {
+                if (mQueue != nullptr)
+                {
+                    std::terminate();
+                }
+
+                mQueue = std::exchange(other.mQueue, nullptr);
+                mPosition = other.mPosition;
+                mIsConstructed = other.mIsConstructed;
+            }
+
+            return *this;
+        }
+
+        // false -> the queue was full
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return mQueue != nullptr;
+        }
+
+        // Must be called exactly once before Commit, the constructor must not throw (the slot would stay claimed)
+        template <typename... Args>
+        T& Emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+        {
+            auto* value{ std::construct_at(mQueue->NodeAt(mPosition).Value(), std::forward<Args>(args)...) };
+            mIsConstructed = true;
+
+            return *value;
+        }
+
+        void Commit() noexcept
+        {
+            if (!mIsConstructed)
+            {
+                std::terminate(); // publishing raw storage
+            }
+
+            mQueue->mStats.OnPush(mQueue->NodeAt(mPosition).Stamp);
+            mQueue->CommitPush(mPosition, 1);
+
+            mQueue = nullptr;
         }
-    }
 
-    ~LFQueue() noexcept = default;
+    private:
+        WriteHandle(LFQueue* queue, std::size_t position) noexcept :
+            mQueue{ queue },
+            mPosition{ position }
+        { }
 
-    [[nodiscard]] bool TryPush(abstract_task_t& task)
+    private:
+        LFQueue* mQueue{ nullptr };
+        std::size_t mPosition{};
+        bool mIsConstructed{ false };
+    };
+
+    // A claimed filled slot: the value is used in place, Release (or the destructor) destroys it and frees the slot
+    class ReadHandle
     {
-        auto old_tail_position{ mTail.load(std::memory_order_relaxed) };
+        friend class LFQueue;
 
-        for (;;)
+    public:
+        ReadHandle() noexcept = default;
+
+        ~ReadHandle() noexcept
         {
-            Node* node{ &mBuffer[old_tail_position & mBufferMask] };
-            auto old_sequence{ node->Sequence.load(std::memory_order_acquire) };
+            Release();
+        }
 
-            if (old_tail_position != old_sequence)
+        ReadHandle(const ReadHandle& other) = delete;
+        ReadHandle& operator=(const ReadHandle& other) = delete;
+
+        ReadHandle(ReadHandle&& other) noexcept :
+            mQueue{ std::exchange(other.mQueue, nullptr) },
+            mPosition{ other.mPosition }
+        { }
+
+        ReadHandle& operator=(ReadHandle&& other) noexcept
+        {
+            if (this != &other)
             {
-                return false;
+                Release();
+
+                mQueue = std::exchange(other.mQueue, nullptr);
+                mPosition = other.mPosition;
             }
 
-            if (mTail.compare_exchange_weak(old_tail_position, old_tail_position + 1))
+            return *this;
+        }
+
+        // false -> the queue was empty
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return mQueue != nullptr;
+        }
+
+        [[nodiscard]] T& operator*() const noexcept
+        {
+            return *mQueue->NodeAt(mPosition).Value();
+        }
+
+        [[nodiscard]] T* operator->() const noexcept
+        {
+            return mQueue->NodeAt(mPosition).Value();
+        }
+
+        void Release() noexcept
+        {
+            if (mQueue != nullptr)
             {
-                node->Task = std::move(task);
-                node->Sequence.store(old_sequence + 1, std::memory_order_release);
+                std::destroy_at(mQueue->NodeAt(mPosition).Value());
+                mQueue->CommitPop(mPosition, 1);
 
-                break;
+                mQueue = nullptr;
             }
         }
 
-        return true;
-    }
+    private:
+        ReadHandle(LFQueue* queue, std::size_t position) noexcept :
+            mQueue{ queue },
+            mPosition{ position }
+        { }
+
+    private:
+        LFQueue* mQueue{ nullptr };
+        std::size_t mPosition{};
+    };
 
-    [[nodiscard]] bool TryPop(abstract_task_t& task)
+public:
+    LFQueue() requires (!IS_DYNAMIC) : 
+        mBufferMask{ Size - 1 }
     {
-        auto old_head_position{ mHead.load(std::memory_order_relaxed) };
-    
-        for (;;)
+        if constexpr (sizeof(Node) * Size > sizeof(std::byte) * 1'024 * 1'024)
         {
-            Node* node{ &mBuffer[old_head_position & mBufferMask] };
-            auto old_sequence{ node->Sequence.load(std::memory_order_acquire) };
+            stack_allocation_warning();
+        }
 
-            if (old_head_position + 1 != old_sequence) // old_head_position + 1 -> is there something in this node ?
-            {
-                return false;
-            }
-            if (IsEmpty())
+        Initialize();
+    }
+
+    // The capacity is rounded up to a power of two (at least 4)
+    explicit LFQueue(std::size_t capacity, Allocator allocator = {}) requires (IS_DYNAMIC) :
+        mBufferMask{ std::bit_ceil(std::max(capacity, std::size_t{ 4 })) - 1 },
+        mAllocator{ std::move(allocator) }
+    {
+        mBuffer = static_cast<Node*>(mAllocator.Allocate(sizeof(Node) * Capacity(), alignof(Node)));
+        std::uninitialized_default_construct_n(mBuffer, Capacity());
+
+        Initialize();
+    }
+
+    // Only the elements which were pushed but never popped are still alive
+    ~LFQueue() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            const auto tail{ mTail.load(std::memory_order_relaxed) };
+            for (auto position{ mHead.load(std::memory_order_relaxed) }; position != tail; ++position)
             {
-                return false;
+                std::destroy_at(NodeAt(position).Value());
             }
+        }
 
-            if (mHead.compare_exchange_weak(old_head_position, old_head_position + 1))
-            {
-                task = std::move(node->Task);
-                node->Sequence.store(old_head_position + Size, std::memory_order_release);
+        if constexpr (IS_DYNAMIC)
+        {
+            std::destroy_n(mBuffer, Capacity());
+            mAllocator.Deallocate(mBuffer, sizeof(Node) * Capacity(), alignof(Node));
+        }
+    }
 
-                break;
-            }
+    [[nodiscard]] bool TryPush(T& value)
+    {
+        std::size_t position{};
+        if (ClaimPush(position, 1) == 0)
+        {
+            mStats.OnFull();
+            return false;
         }
 
+        MoveIn(NodeAt(position), value);
+        CommitPush(position, 1);
+
+        return true;
+    }
+
+    [[nodiscard]] bool TryPop(T& value)
+    {
+        std::size_t position{};
+        if (ClaimPop(position, 1) == 0)
+        {
+            mStats.OnEmpty();
+            return false;
+        }
+
+        MoveOut(NodeAt(position), value);
+        CommitPop(position, 1);
+
         return true;
     }
 
+    // Claims up to std::size(values) consecutive slots at once, returns how many values were moved into the queue
+    [[nodiscard]] std::size_t TryPushBulk(std::span<T> values)
+    {
+        std::size_t position{};
+        auto count{ ClaimPush(position, std::size(values)) };
+        if (count == 0 && !std::empty(values))
+        {
+            mStats.OnFull();
+        }
+
+        for (std::size_t i{}; i < count; ++i)
+        {
+            MoveIn(NodeAt(position + i), values[i]);
+        }
+
+        CommitPush(position, count);
+        return count;
+    }
+
+    // Claims up to std::size(values) consecutive filled slots at once, returns how many values were moved out of the queue
+    [[nodiscard]] std::size_t TryPopBulk(std::span<T> values)
+    {
+        std::size_t position{};
+        auto count{ ClaimPop(position, std::size(values)) };
+        if (count == 0 && !std::empty(values))
+        {
+            mStats.OnEmpty();
+        }
+
+        for (std::size_t i{}; i < count; ++i)
+        {
+            MoveOut(NodeAt(position + i), values[i]);
+        }
+
+        CommitPop(position, count);
+        return count;
+    }
+
+    // Constructs T(args...) in the slot, only once a slot was claimed -> a full queue costs no construction and
+    // the arguments are left untouched (a moved callable can be passed again on retry)
+    template <typename... Args>
+    [[nodiscard]] bool TryEmplace(Args&&... args) noexcept
+    {
+        static_assert(std::is_nothrow_constructible_v<T, Args...>, "The construction must not throw once the slot is claimed, use TryPush");
+
+        auto handle{ TryClaimWrite() };
+        if (!handle)
+        {
+            return false;
+        }
+
+        handle.Emplace(std::forward<Args>(args)...);
+        handle.Commit();
+
+        return true;
+    }
+
+    // Zero-copy push: construct the value in the claimed slot and commit it, see WriteHandle.
+    // Several handles may be outstanding at once and finished in any order, with every concurrency policy.
+    [[nodiscard]] WriteHandle TryClaimWrite() noexcept
+    {
+        std::size_t position{};
+        if (ClaimPush(position, 1) == 0)
+        {
+            mStats.OnFull();
+            return WriteHandle{};
+        }
+
+        return WriteHandle{ this, position };
+    }
+
+    // Zero-copy pop: use the value in its slot, see ReadHandle
+    [[nodiscard]] ReadHandle TryClaimRead() noexcept
+    {
+        std::size_t position{};
+        if (ClaimPop(position, 1) == 0)
+        {
+            mStats.OnEmpty();
+            return ReadHandle{};
+        }
+
+        mStats.OnPop(NodeAt(position).Stamp);
+        return ReadHandle{ this, position };
+    }
+
+    [[nodiscard]] inline const Stats& GetStats() const noexcept
+    {
+        return mStats;
+    }
+
     [[nodiscard]] inline bool IsEmpty() const noexcept
     {
         return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_acquire);
     }
 
+    // The number of push slots claimed so far, it only grows -> front-ends compare two reads to detect pushes in between
+    [[nodiscard]] inline std::size_t PushPosition() const noexcept
+    {
+        return mTail.load(std::memory_order_acquire);
+    }
+
+    // Approximate number of values in the queue (claimed slots included), exact only when nobody pushes or pops
+    [[nodiscard]] inline std::size_t ApproxSize() const noexcept
+    {
+        const auto head{ mHead.load(std::memory_order_relaxed) };
+        const auto size{ static_cast<std::intptr_t>(mTail.load(std::memory_order_relaxed) - head) };
+
+        return std::min(static_cast<std::size_t>(std::max<std::intptr_t>(size, 0)), Capacity());
+    }
+
+    [[nodiscard]] constexpr std::size_t Capacity() const noexcept
+    {
+        if constexpr (IS_DYNAMIC)
+        {
+            return mBufferMask + 1;
+        }
+        else
+        {
+            return Size;
+        }
+    }
+
 private:
-    struct alignas(std::hardware_destructive_interference_size) Node
+    constexpr static std::size_t NODE_ALIGNMENT
+    { 
+        Layout::PACKED ? std::max(alignof(T), alignof(std::atomic<std::size_t>)) : std::hardware_destructive_interference_size 
+    };
+
+    // The value lives in raw storage: it is constructed by a push and destroyed by a pop
+    struct alignas(NODE_ALIGNMENT) Node
     {
         Node() = default;
         ~Node() noexcept = default;
 
-        abstract_task_t Task; 
+        [[nodiscard]] inline T* Value() noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(Storage));
+        }
+
+        alignas(T) std::byte Storage[sizeof(T)];
         std::atomic<std::size_t> Sequence;
+
+        [[no_unique_address]] typename Stats::Stamp Stamp;
     };
 
+    constexpr static std::size_t SLOTS_PER_LINE
+    { 
+        Layout::PACKED ? std::bit_floor(std::max(std::hardware_destructive_interference_size / sizeof(Node), std::size_t{ 1 })) : 1 
+    };
+
+    void MoveIn(Node& node, T& value) noexcept
+    {
+        std::construct_at(node.Value(), std::move(value));
+        mStats.OnPush(node.Stamp);
+    }
+
+    void MoveOut(Node& node, T& value) noexcept
+    {
+        auto* stored_value{ node.Value() };
+        mStats.OnPop(node.Stamp);
+
+        value = std::move(*stored_value);
+        std::destroy_at(stored_value);
+    }
+
+    void Initialize() noexcept
+    {
+        if constexpr (SLOTS_PER_LINE > 1)
+        {
+            const auto line_count{ Capacity() / SLOTS_PER_LINE };
+
+            mLineMask = line_count - 1;
+            mColumnShift = static_cast<std::size_t>(std::countr_zero(line_count));
+        }
+
+        mHead.store(0, std::memory_order_relaxed);
+        mTail.store(0, std::memory_order_relaxed);
+
+        mClaimedHead = 0;
+        mClaimedTail = 0;
+
+        for (std::size_t i{}; i < Capacity(); ++i)
+        {
+            NodeAt(i).Sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // The packed layout puts consecutive positions on different lines: position -> (line, column),
+    // so neighbouring producers/consumers don't write to the same line
+    [[nodiscard]] inline Node& NodeAt(std::size_t position) noexcept
+    {
+        if constexpr (SLOTS_PER_LINE > 1)
+        {
+            return mBuffer[layout::PackedIndex(position & mBufferMask, mLineMask, mColumnShift, SLOTS_PER_LINE)];
+        }
+        else
+        {
+            return mBuffer[position & mBufferMask];
+        }
+    }
+
+    // Counts the consecutive nodes starting at position whose sequence is position + offset,
+    // a negative difference on the first node means the queue is full/empty, a positive one - the index is stale
+    [[nodiscard]] std::size_t CountReady(std::size_t position, std::size_t offset, std::size_t count, std::intptr_t& difference) noexcept
+    {
+        std::size_t ready{};
+        for (; ready < count; ++ready)
+        {
+            auto sequence{ NodeAt(position + ready).Sequence.load(std::memory_order_acquire) };
+            if (sequence != position + ready + offset)
+            {
+                if (ready == 0)
+                {
+                    difference = static_cast<std::intptr_t>(sequence - (position + offset));
+                }
+
+                break;
+            }
+        }
+
+        return ready;
+    }
+
+    // SPSC: the claim cursor of a side runs ahead of its published index while handles are outstanding.
+    // Slots finished out of claim order are only marked (sequence = position + offset, the sequences aren't used otherwise),
+    // the index moves over them once the slots before them are finished. The push and pop marks never match each other.
+    void Publish(std::atomic<std::size_t>& index, std::size_t claimed, std::size_t position, std::size_t count, std::size_t offset) noexcept
+    {
+        if (index.load(std::memory_order_relaxed) != position)
+        {
+            for (std::size_t i{}; i < count; ++i)
+            {
+                NodeAt(position + i).Sequence.store(position + i + offset, std::memory_order_relaxed);
+            }
+
+            return;
+        }
+
+        position += count;
+        while (position != claimed && NodeAt(position).Sequence.load(std::memory_order_relaxed) == position + offset)
+        {
+            ++position;
+        }
+
+        index.store(position, std::memory_order_release);
+    }
+
+    // Returns the number of slots claimed starting at position, they must be published with CommitPush
+    [[nodiscard]] std::size_t ClaimPush(std::size_t& position, std::size_t count) noexcept
+    {
+        if constexpr (USE_CACHED_INDICES)
+        {
+            position = mClaimedTail;
+
+            if (Capacity() - (position - mCachedHead) < count)
+            {
+                mCachedHead = mHead.load(std::memory_order_acquire);
+            }
+
+            count = std::min(count, Capacity() - (position - mCachedHead));
+            mClaimedTail += count;
+
+            return count;
+        }
+        else if constexpr (!MULTI_PRODUCER)
+        {
+            std::intptr_t difference{};
+
+            position = mTail.load(std::memory_order_relaxed);
+            count = CountReady(position, 0, count, difference);
+
+            mTail.store(position + count, std::memory_order_relaxed);
+            return count;
+        }
+        else
+        {
+            position = mTail.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                std::intptr_t difference{};
+                auto ready{ CountReady(position, 0, count, difference) };
+
+                if (ready == 0)
+                {
+                    if (difference < 0 || count == 0) // the queue is full
+                    {
+                        return 0;
+                    }
+
+                    mStats.OnCasRetry();
+                    position = mTail.load(std::memory_order_relaxed); // someone has already taken this slot
+                    continue;
+                }
+
+                if (mTail.compare_exchange_weak(position, position + ready))
+                {
+                    return ready;
+                }
+
+                mStats.OnCasRetry();
+            }
+        }
+    }
+
+    void CommitPush(std::size_t position, std::size_t count) noexcept
+    {
+        if constexpr (USE_CACHED_INDICES)
+        {
+            Publish(mTail, mClaimedTail, position, count, 1);
+        }
+        else
+        {
+            for (std::size_t i{}; i < count; ++i)
+            {
+                NodeAt(position + i).Sequence.store(position + i + 1, std::memory_order_release);
+            }
+        }
+    }
+
+    // Returns the number of filled slots claimed starting at position, they must be released with CommitPop
+    [[nodiscard]] std::size_t ClaimPop(std::size_t& position, std::size_t count) noexcept
+    {
+        if constexpr (USE_CACHED_INDICES)
+        {
+            position = mClaimedHead;
+
+            if (mCachedTail - position < count)
+            {
+                mCachedTail = mTail.load(std::memory_order_acquire);
+            }
+
+            count = std::min(count, mCachedTail - position);
+            mClaimedHead += count;
+
+            return count;
+        }
+        else if constexpr (!MULTI_CONSUMER)
+        {
+            std::intptr_t difference{};
+
+            position = mHead.load(std::memory_order_relaxed);
+            count = CountReady(position, 1, count, difference);
+
+            mHead.store(position + count, std::memory_order_relaxed);
+            return count;
+        }
+        else
+        {
+            position = mHead.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                std::intptr_t difference{};
+                auto ready{ CountReady(position, 1, count, difference) }; // position + 1 -> is there something in this node ?
+
+                if (ready == 0)
+                {
+                    if (difference < 0 || count == 0) // the queue is empty
+                    {
+                        return 0;
+                    }
+
+                    mStats.OnCasRetry();
+                    position = mHead.load(std::memory_order_relaxed); // someone has already taken this slot
+                    continue;
+                }
+
+                if (mHead.compare_exchange_weak(position, position + ready))
+                {
+                    return ready;
+                }
+
+                mStats.OnCasRetry();
+            }
+        }
+    }
+
+    void CommitPop(std::size_t position, std::size_t count) noexcept
+    {
+        if constexpr (USE_CACHED_INDICES)
+        {
+            Publish(mHead, mClaimedHead, position, count, Capacity());
+        }
+        else
+        {
+            for (std::size_t i{}; i < count; ++i)
+            {
+                NodeAt(position + i).Sequence.store(position + i + Capacity(), std::memory_order_release);
+            }
+        }
+    }
+
+private:
     const std::size_t mBufferMask;
 
+    std::size_t mLineMask{};
+    std::size_t mColumnShift{};
+
+    // each side keeps its cached copy of the remote index on its own cache line
     alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> mHead;
+    std::size_t mCachedTail{};
+    std::size_t mClaimedHead{};
+
     alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> mTail;
+    std::size_t mCachedHead{};
+    std::size_t mClaimedTail{};
+
+    alignas(std::hardware_destructive_interference_size) std::conditional_t<IS_DYNAMIC, Node*, std::array<Node, IS_DYNAMIC ? 1 : Size>> mBuffer;
+    [[no_unique_address]] Allocator mAllocator;
+    [[no_unique_address]] Stats mStats;
+};
+
+template <typename T, std::size_t Size>
+using MPSCQueue = LFQueue<T, Size, concurrency::MPSC>;
+
+template <typename T, std::size_t Size>
+using SPMCQueue = LFQueue<T, Size, concurrency::SPMC>;
+
+template <typename T, std::size_t Size>
+using SPSCQueue = LFQueue<T, Size, concurrency::SPSC>;
+
+// The capacity is chosen at runtime, the buffer comes from Allocator (e.g. memory::HugePageAllocator)
+template <typename T, typename Concurrency = concurrency::MPMC, typename Allocator = memory::DefaultBufferAllocator>
+using LFHeapQueue = LFQueue<T, std::dynamic_extent, Concurrency, Allocator>;
+
+// Several slots per cache line, see layout::Packed
+template <typename T, std::size_t Size, typename Concurrency = concurrency::MPMC>
+using LFPackedQueue = LFQueue<T, Size, Concurrency, memory::DefaultBufferAllocator, layout::Packed>;
+
+// The task queue -> tasks with the default return type (32-bit integer)
+template <std::size_t Size, typename Concurrency = concurrency::MPMC, typename Layout = layout::Padded>
+using LFTaskQueue = LFQueue<abstract_task::Task<std::int32_t()>, Size, Concurrency, memory::DefaultBufferAllocator, Layout>;
 
-    alignas(std::hardware_destructive_interference_size) std::array<Node, Size> mBuffer;
-};
\ No newline at end of file
+// Counts pushes/pops/failures/CAS retries and records the sojourn time of every value, see queue_stats::QueueStats
+template <typename T, std::size_t Size, typename Concurrency = concurrency::MPMC>
+using LFStatsQueue = LFQueue<T, Size, Concurrency, memory::DefaultBufferAllocator, layout::Padded, queue_stats::QueueStats>;
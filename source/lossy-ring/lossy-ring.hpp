@@ -0,0 +1,202 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <bit>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+
+// Overwrite-on-full broadcast ring for telemetry: producers never wait, the oldest entries are overwritten.
+// Every reader has its own cursor (Reader), a reader which was lapped skips to the oldest entry still in the ring
+// and counts the skipped entries as lost.
+// Every slot is a seqlock over its Sequence: 2 * position + 1 while position is being written, 2 * position + 2 once done.
+// The payload is copied through relaxed atomic words, so a reader racing with a writer never touches a torn T.
+template <typename T, std::size_t Size>
+class LossyRing
+{
+    static_assert(Size > 2, "Size must be > 2");
+    static_assert(std::has_single_bit(Size), "Size must be power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+    constexpr static std::size_t MASK{ Size - 1 };
+    constexpr static std::size_t WORD_COUNT{ (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t) };
+
+    using words_t = std::array<std::uint64_t, WORD_COUNT>;
+
+    struct alignas(std::hardware_destructive_interference_size) Node
+    {
+        std::atomic<std::uint64_t> Sequence{};
+        std::array<std::atomic<std::uint64_t>, WORD_COUNT> Words{};
+    };
+
+public:
+    using value_type = T;
+
+    class Reader
+    {
+    public:
+        // Starts at the current tail -> sees what is pushed from now on
+        explicit Reader(const LossyRing& ring) noexcept :
+            mRing{ &ring },
+            mPosition{ ring.mTail.load(std::memory_order_acquire) }
+        { }
+
+        [[nodiscard]] bool TryRead(T& value) noexcept
+        {
+            for (;;)
+            {
+                const auto& node{ mRing->mNodes[mPosition & MASK] };
+                const auto written{ 2 * mPosition + 2 };
+                const auto sequence{ node.Sequence.load(std::memory_order_acquire) };
+
+                if (sequence == written)
+                {
+                    words_t words;
+                    for (std::size_t i{}; i < WORD_COUNT; ++i)
+                    {
+                        words[i] = node.Words[i].load(std::memory_order_relaxed);
+                    }
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (node.Sequence.load(std::memory_order_relaxed) == written)
+                    {
+                        std::memcpy(&value, std::data(words), sizeof(T));
+                        ++mPosition;
+
+                        return true;
+                    }
+
+                    Resync(); // overwritten while we were copying it
+                }
+                else if (sequence > written) // a later lap is (being) written here
+                {
+                    Resync();
+                }
+                else if (mRing->mTail.load(std::memory_order_acquire) - mPosition > Size)
+                {
+                    // a whole lap was claimed after this position but it was never completed (its producer dropped it)
+                    ++mPosition;
+                    ++mLost;
+                }
+                else
+                {
+                    return false; // not written yet
+                }
+            }
+        }
+
+        // Entries this reader missed because it was too slow
+        [[nodiscard]] inline std::uint64_t Lost() const noexcept
+        {
+            return mLost;
+        }
+
+    private:
+        void Resync() noexcept
+        {
+            const auto tail{ mRing->mTail.load(std::memory_order_acquire) };
+            const auto oldest{ std::max(mPosition + 1, tail > Size ? tail - Size : 0) };
+
+            mLost += oldest - mPosition;
+            mPosition = oldest;
+        }
+
+    private:
+        const LossyRing* mRing;
+        std::uint64_t mPosition;
+        std::uint64_t mLost{};
+    };
+
+public:
+    LossyRing() = default;
+    ~LossyRing() noexcept = default;
+
+    LossyRing(const LossyRing& other) = delete;
+    LossyRing& operator=(const LossyRing& other) = delete;
+
+    // Wait-free for the producer: claims the next position and overwrites whatever is in the slot
+    void Push(const T& value) noexcept
+    {
+        const auto position{ mTail.fetch_add(1, std::memory_order_relaxed) };
+        auto& node{ mNodes[position & MASK] };
+
+        const auto writing{ 2 * position + 1 };
+        auto sequence{ node.Sequence.load(std::memory_order_relaxed) };
+
+        do
+        {
+            // a producer preempted for a whole lap still writes here, or a later lap already did -> drop this entry
+            if ((sequence & 1) != 0 || sequence > writing)
+            {
+                mDropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        } while (!node.Sequence.compare_exchange_weak(sequence, writing, std::memory_order_relaxed));
+
+        std::atomic_thread_fence(std::memory_order_release);
+
+        words_t words{};
+        std::memcpy(std::data(words), &value, sizeof(T));
+
+        for (std::size_t i{}; i < WORD_COUNT; ++i)
+        {
+            node.Words[i].store(words[i], std::memory_order_relaxed);
+        }
+
+        node.Sequence.store(writing + 1, std::memory_order_release);
+    }
+
+    [[nodiscard]] Reader MakeReader() const noexcept
+    {
+        return Reader{ *this };
+    }
+
+    // Entries the producers had to drop because the slot was still taken by another producer (rare, needs a whole lap)
+    [[nodiscard]] inline std::uint64_t Dropped() const noexcept
+    {
+        return mDropped.load(std::memory_order_relaxed);
+    }
+
+    // Entries pushed so far
+    [[nodiscard]] inline std::uint64_t Position() const noexcept
+    {
+        return mTail.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] constexpr std::size_t Capacity() const noexcept
+    {
+        return Size;
+    }
+
+private:
+    alignas(std::hardware_destructive_interference_size) std::atomic<std::uint64_t> mTail{};
+    alignas(std::hardware_destructive_interference_size) std::atomic<std::uint64_t> mDropped{};
+
+    std::array<Node, Size> mNodes{};
+};
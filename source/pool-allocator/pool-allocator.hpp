@@ -0,0 +1,293 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <bit>
+#include <array>
+#include <algorithm>
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace memory
+{
+    // Size-class pool for small objects which are allocated on one thread and freed on another (task callables, result states):
+    // - every thread allocates from its own heap, the fast path has no atomics
+    // - a block freed by a foreign thread goes back to its heap through a lock-free list, the owner takes the whole list at once
+    // - chunks are never returned to the system: the heap of an exited thread becomes an orphan and is adopted by the next new thread
+    // The interface is the same as the one of the buffer allocators, bigger or over-aligned requests go to the global operator new.
+    // Not for use in thread_local destructors which run after the heap of the thread has been orphaned.
+    class PoolAllocator
+    {
+    public:
+        constexpr static std::size_t MIN_BLOCK_SIZE{ 16 };
+        constexpr static std::size_t MAX_BLOCK_SIZE{ 2'048 };
+        constexpr static std::size_t CHUNK_SIZE{ 64 * 1'024 };
+
+    private:
+        constexpr static std::size_t CLASS_COUNT{ static_cast<std::size_t>(std::countr_zero(MAX_BLOCK_SIZE) - std::countr_zero(MIN_BLOCK_SIZE) + 1) };
+        constexpr static std::size_t LINE_SIZE{ std::hardware_destructive_interference_size };
+
+        // Blocks are carved right after the chunk header: a block of size S is aligned to min(S, LINE_SIZE)
+        constexpr static std::size_t MAX_ALIGNMENT{ LINE_SIZE };
+
+        struct Block
+        {
+            Block* Next;
+        };
+
+        struct alignas(LINE_SIZE) Bin
+        {
+            Block* Free{ nullptr };      // owner only
+            std::byte* Cursor{ nullptr }; // not yet carved part of the newest chunk
+            std::byte* End{ nullptr };
+
+            alignas(LINE_SIZE) std::atomic<Block*> RemoteFree{ nullptr };
+        };
+
+        struct Heap;
+
+        // Chunks are aligned to their size -> the header of any block is found by masking its address
+        struct alignas(LINE_SIZE) Chunk
+        {
+            Heap* Owner;
+            std::size_t SizeClass;
+            Chunk* Next;
+        };
+
+        struct Heap
+        {
+            std::array<Bin, CLASS_COUNT> Bins;
+
+            Chunk* Chunks{ nullptr }; // keeps the chunks reachable for leak checkers
+            Heap* NextOrphan{ nullptr };
+        };
+
+        // Unregisters the heap when its thread exits
+        struct HeapHandle
+        {
+            ~HeapHandle() noexcept
+            {
+                if (Value != nullptr)
+                {
+                    Orphan(std::exchange(Value, nullptr)); // later frees on this thread take the remote path
+                }
+            }
+
+            Heap* Value{ nullptr };
+        };
+
+        struct Globals
+        {
+            std::mutex OrphanMutex;
+            Heap* Orphans{ nullptr };
+
+            std::atomic<std::size_t> ChunkCount{};
+        };
+
+    public:
+        [[nodiscard]] void* Allocate(std::size_t bytes, std::size_t alignment)
+        {
+            const auto size_class{ SizeClass(bytes, alignment) };
+            if (size_class == CLASS_COUNT)
+            {
+                return ::operator new(bytes, std::align_val_t{ alignment });
+            }
+
+            auto& heap{ LocalHeap() };
+            auto& bin{ heap.Bins[size_class] };
+
+            if (bin.Free == nullptr && bin.RemoteFree.load(std::memory_order_relaxed) != nullptr)
+            {
+                bin.Free = bin.RemoteFree.exchange(nullptr, std::memory_order_acquire);
+            }
+
+            if (bin.Free != nullptr)
+            {
+                auto* block{ bin.Free };
+                bin.Free = block->Next;
+
+                return block;
+            }
+
+            if (bin.Cursor == bin.End)
+            {
+                Refill(heap, size_class);
+            }
+
+            auto* block{ bin.Cursor };
+            bin.Cursor += BlockSize(size_class);
+
+            return block;
+        }
+
+        void Deallocate(void* pointer, std::size_t bytes, std::size_t alignment) noexcept
+        {
+            if (SizeClass(bytes, alignment) == CLASS_COUNT)
+            {
+                ::operator delete(pointer, bytes, std::align_val_t{ alignment });
+                return;
+            }
+
+            auto* chunk{ reinterpret_cast<Chunk*>(reinterpret_cast<std::uintptr_t>(pointer) & ~(CHUNK_SIZE - 1)) };
+            auto& bin{ chunk->Owner->Bins[chunk->SizeClass] };
+            auto* block{ ::new (pointer) Block{ nullptr } };
+
+            if (chunk->Owner == LocalHandle().Value)
+            {
+                block->Next = bin.Free;
+                bin.Free = block;
+
+                return;
+            }
+
+            auto* head{ bin.RemoteFree.load(std::memory_order_relaxed) };
+            do
+            {
+                block->Next = head;
+            }
+            while (!bin.RemoteFree.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        // Chunks taken from the system so far, all threads together
+        [[nodiscard]] static std::size_t ChunkCount() noexcept
+        {
+            return GetGlobals().ChunkCount.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] constexpr bool operator==(const PoolAllocator& other) const noexcept = default;
+
+    private:
+        [[nodiscard]] constexpr static std::size_t SizeClass(std::size_t bytes, std::size_t alignment) noexcept
+        {
+            const auto size{ std::max({ bytes, alignment, MIN_BLOCK_SIZE }) };
+            if (size > MAX_BLOCK_SIZE || alignment > MAX_ALIGNMENT)
+            {
+                return CLASS_COUNT;
+            }
+
+            return static_cast<std::size_t>(std::bit_width(size - 1) - std::countr_zero(MIN_BLOCK_SIZE));
+        }
+
+        [[nodiscard]] constexpr static std::size_t BlockSize(std::size_t size_class) noexcept
+        {
+            return MIN_BLOCK_SIZE << size_class;
+        }
+
+        static void Refill(Heap& heap, std::size_t size_class)
+        {
+            auto* chunk_memory{ static_cast<std::byte*>(::operator new(CHUNK_SIZE, std::align_val_t{ CHUNK_SIZE })) };
+            heap.Chunks = ::new (chunk_memory) Chunk{ &heap, size_class, heap.Chunks };
+
+            const auto block_size{ BlockSize(size_class) };
+            const auto block_count{ (CHUNK_SIZE - sizeof(Chunk)) / block_size };
+
+            auto& bin{ heap.Bins[size_class] };
+            bin.Cursor = chunk_memory + sizeof(Chunk);
+            bin.End = bin.Cursor + block_count * block_size;
+
+            GetGlobals().ChunkCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] static Heap& LocalHeap()
+        {
+            auto& handle{ LocalHandle() };
+            if (handle.Value == nullptr) [[unlikely]]
+            {
+                handle.Value = AdoptOrCreate();
+            }
+
+            return *handle.Value;
+        }
+
+        [[nodiscard]] static HeapHandle& LocalHandle() noexcept
+        {
+            thread_local HeapHandle handle{};
+            return handle;
+        }
+
+        [[nodiscard]] static Heap* AdoptOrCreate()
+        {
+            auto& globals{ GetGlobals() };
+            {
+                std::lock_guard<std::mutex> lock{ globals.OrphanMutex };
+                if (auto* heap{ globals.Orphans }; heap != nullptr)
+                {
+                    globals.Orphans = heap->NextOrphan;
+                    return heap;
+                }
+            }
+
+            return new Heap{};
+        }
+
+        static void Orphan(Heap* heap) noexcept
+        {
+            auto& globals{ GetGlobals() };
+
+            std::lock_guard<std::mutex> lock{ globals.OrphanMutex };
+            heap->NextOrphan = globals.Orphans;
+            globals.Orphans = heap;
+        }
+
+        [[nodiscard]] static Globals& GetGlobals() noexcept
+        {
+            static Globals globals{};
+            return globals;
+        }
+    };
+
+    // PoolAllocator as a standard allocator, e.g. for std::promise(std::allocator_arg, ...) and std::allocate_shared
+    template <typename T>
+    class PoolStdAllocator
+    {
+    public:
+        using value_type = T;
+
+    public:
+        PoolStdAllocator() noexcept = default;
+
+        template <typename U>
+        PoolStdAllocator(const PoolStdAllocator<U>&) noexcept
+        { }
+
+        [[nodiscard]] T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(PoolAllocator{}.Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* pointer, std::size_t count) noexcept
+        {
+            PoolAllocator{}.Deallocate(pointer, count * sizeof(T), alignof(T));
+        }
+
+        template <typename U>
+        [[nodiscard]] bool operator==(const PoolStdAllocator<U>&) const noexcept
+        {
+            return true;
+        }
+    };
+}
@@ -0,0 +1,189 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <bit>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#include <lock-free-bounded-queue/lock-free-bounded-queue.hpp>
+
+// LaneCount LFQueue lanes, one per priority class (lane 0 -> the highest priority), the producer picks the lane.
+// A bitmask of (possibly) non-empty lanes lets consumers find the next lane with countr_zero instead of scanning.
+template <typename T, std::size_t LaneSize, std::size_t LaneCount, typename Concurrency = concurrency::MPMC>
+class PriorityLFQueue
+{
+    static_assert(LaneCount > 0 && LaneCount <= 64, "LaneCount must be in [1, 64]");
+
+    using lane_t = LFQueue<T, LaneSize, Concurrency>;
+
+public:
+    using value_type = T;
+
+    // Per-consumer state for the weighted round-robin TryPop, a default one starts with a full turn on lane 0
+    struct WeightedCursor
+    {
+        std::size_t Lane{};
+        std::uint32_t Taken{}; // values taken from Lane in the current turn
+    };
+
+public:
+    // weights[i] -> how many values the weighted round-robin TryPop takes from lane i in a row (0 is treated as 1)
+    explicit PriorityLFQueue(const std::array<std::uint32_t, LaneCount>& weights = DefaultWeights())
+    {
+        std::ranges::transform(weights, std::begin(mWeights), [](std::uint32_t weight) -> std::uint32_t
+        {
+            return std::max(weight, std::uint32_t{ 1 });
+        });
+    }
+
+    ~PriorityLFQueue() noexcept = default;
+
+    PriorityLFQueue(const PriorityLFQueue& other) = delete;
+    PriorityLFQueue& operator=(const PriorityLFQueue& other) = delete;
+
+    [[nodiscard]] bool TryPush(T& value, std::size_t lane)
+    {
+        if (!mLanes[lane].TryPush(value))
+        {
+            return false;
+        }
+
+        // Always a RMW (release): a consumer which clears this bit afterwards is guaranteed to see the push
+        mNonEmpty.fetch_or(LaneBit(lane), std::memory_order_acq_rel);
+        return true;
+    }
+
+    // Strict priority: always takes from the highest priority non-empty lane (lower lanes may starve)
+    [[nodiscard]] bool TryPop(T& value)
+    {
+        auto non_empty{ mNonEmpty.load(std::memory_order_acquire) };
+
+        while (non_empty != 0)
+        {
+            const auto lane{ static_cast<std::size_t>(std::countr_zero(non_empty)) };
+            if (mLanes[lane].TryPop(value))
+            {
+                return true;
+            }
+
+            ClearIfEmpty(lane);
+            non_empty &= non_empty - 1;
+        }
+
+        return false;
+    }
+
+    // Weighted round-robin: takes up to weights[lane] values from a lane, then moves on to the next non-empty one
+    [[nodiscard]] bool TryPop(T& value, WeightedCursor& cursor)
+    {
+        auto non_empty{ mNonEmpty.load(std::memory_order_acquire) };
+
+        while (non_empty != 0)
+        {
+            if (cursor.Taken >= mWeights[cursor.Lane])
+            {
+                cursor.Lane = (cursor.Lane + 1) % LaneCount;
+                cursor.Taken = 0;
+            }
+
+            // the first non-empty lane at or after the cursor (cyclic)
+            const auto upper_lanes{ non_empty >> cursor.Lane };
+            const auto lane{ upper_lanes != 0 ? cursor.Lane + static_cast<std::size_t>(std::countr_zero(upper_lanes)) : static_cast<std::size_t>(std::countr_zero(non_empty)) };
+
+            if (lane != cursor.Lane)
+            {
+                cursor.Lane = lane;
+                cursor.Taken = 0;
+            }
+
+            if (mLanes[lane].TryPop(value))
+            {
+                ++cursor.Taken;
+                return true;
+            }
+
+            ClearIfEmpty(lane);
+            non_empty &= ~LaneBit(lane);
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] inline bool IsEmpty() const noexcept
+    {
+        return std::ranges::all_of(mLanes, [](const lane_t& lane) -> bool { return lane.IsEmpty(); });
+    }
+
+    [[nodiscard]] inline std::size_t ApproxSize() const noexcept
+    {
+        std::size_t size{};
+        for (const auto& lane : mLanes)
+        {
+            size += lane.ApproxSize();
+        }
+
+        return size;
+    }
+
+    [[nodiscard]] constexpr std::size_t LaneCapacity() const noexcept
+    {
+        return LaneSize;
+    }
+
+private:
+    [[nodiscard]] constexpr static std::uint64_t LaneBit(std::size_t lane) noexcept
+    {
+        return std::uint64_t{ 1 } << lane;
+    }
+
+    [[nodiscard]] constexpr static std::array<std::uint32_t, LaneCount> DefaultWeights() noexcept
+    {
+        std::array<std::uint32_t, LaneCount> weights{};
+        weights.fill(1);
+
+        return weights;
+    }
+
+    // The bit is only a hint, a failed pop clears it and sets it back if a producer got in between
+    // (its fetch_or either comes after our fetch_and or synchronizes with it, so the emptiness check sees its push)
+    void ClearIfEmpty(std::size_t lane) noexcept
+    {
+        mNonEmpty.fetch_and(~LaneBit(lane), std::memory_order_acq_rel);
+
+        if (!mLanes[lane].IsEmpty())
+        {
+            mNonEmpty.fetch_or(LaneBit(lane), std::memory_order_acq_rel);
+        }
+    }
+
+private:
+    std::array<std::uint32_t, LaneCount> mWeights{};
+    alignas(std::hardware_destructive_interference_size) std::atomic<std::uint64_t> mNonEmpty{};
+
+    std::array<lane_t, LaneCount> mLanes;
+};
@@ -32,6 +32,10 @@
 
 #include <lock-free-bounded-queue/lock-free-bounded-queue.hpp>
 
+#if defined (USE_QUEUE_TRACY)
+    #include <queue-tracy/queue-tracy.hpp>
+#endif
+
 #if defined (USE_THREAD_YIELD)
     #define thread_yield() std::this_thread::yield()
 #else 
@@ -42,7 +46,19 @@ constexpr static std::size_t QUEUE_SIZE{ 1 << 10 };
 constexpr static std::size_t TASK_COUNT{ 100'000 }; // The number of tasks must be divided by the number of producers 
 constexpr static std::size_t RANDOM_BUFFER_SIZE{ 2'048 };
 
-using LFQueue_ = LFQueue<QUEUE_SIZE>;
+#if defined (USE_PACKED_LAYOUT)
+    using Layout_ = layout::Packed;
+#else
+    using Layout_ = layout::Padded;
+#endif
+
+#if defined (USE_QUEUE_TRACY)
+    using LFQueue_ = queue_tracy::TracedQueue<LFQueue<abstract_task::Task<std::int32_t()>, QUEUE_SIZE, concurrency::MPMC, memory::DefaultBufferAllocator, Layout_, queue_tracy::TracyStats<>>>;
+    #define run_task(task) queue_tracy::RunTask(task)
+#else
+    using LFQueue_ = LFTaskQueue<QUEUE_SIZE, concurrency::MPMC, Layout_>;
+    #define run_task(task) task()
+#endif
 using SortBuffer_ = std::vector<std::ptrdiff_t>;
 
 using FutureBuffer_ = std::vector<std::future<SortBuffer_>>;
@@ -111,9 +127,10 @@ void Producer(LFQueue_& queue, FutureBuffer_& future_buffer, std::mutex& mutex,
 
     for (std::ptrdiff_t i{}; i < task_count; ++i)
     {
-        auto&& [task, future] { abstract_task::CreateTask(BubbleSort) };
+        // the task is only built inside the slot once one is claimed, a full queue costs nothing
+        auto&& [callable, future] { abstract_task::PackageTask(BubbleSort) };
 
-        while (!queue.TryPush(task))
+        while (!queue.TryEmplace(std::move(callable)))
         {
             thread_yield();
         }
@@ -131,10 +148,10 @@ void Consumer(LFQueue_& queue, DoneFlag_& is_done)
 
     while (!is_done.load(std::memory_order_acquire) || !queue.IsEmpty())
     {
-        LFQueue_::abstract_task_t task{};
+        LFQueue_::value_type task{};
         if (queue.TryPop(task))
         {
-            if (task() != 0)
+            if (run_task(task) != 0)
             {
                 std::cerr << "Error: task() != 0, thread_id: " << std::this_thread::get_id() << '\n';
                 return;
@@ -151,7 +168,12 @@ void StartProfiling(const std::size_t consumer_threads_count, const std::size_t
 {
     ZoneScopedNC(__FUNCTION__, tracy::Color::Green);
 
+#if defined (USE_QUEUE_TRACY)
+    queue_tracy::Sampling::SetPeriod(QUEUE_TRACY_SAMPLE_PERIOD);
+    LFQueue_ queue{ "Queue size" };
+#else
     LFQueue_ queue{};
+#endif
     DoneFlag_ is_done{ false };
 
     std::mutex mutex{};
@@ -0,0 +1,223 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <bit>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+// Statistics policies for LFQueue (the Stats template parameter).
+// The queue calls the hooks below, with NoStats all of them are empty and the slot stamp takes no space.
+namespace queue_stats
+{
+    class NoStats
+    {
+    public:
+        struct Stamp {};
+
+    public:
+        inline void OnPush([[maybe_unused]] Stamp& stamp) noexcept { }
+        inline void OnPop([[maybe_unused]] const Stamp& stamp) noexcept { }
+
+        inline void OnFull() noexcept { }
+        inline void OnEmpty() noexcept { }
+        inline void OnCasRetry() noexcept { }
+    };
+
+    // HDR-style histogram: every power of two is split into 2^SUB_BUCKET_BITS linear sub-buckets (12.5% precision)
+    class LogHistogram
+    {
+    public:
+        constexpr static std::size_t SUB_BUCKET_BITS{ 3 };
+        constexpr static std::size_t SUB_BUCKETS{ 1 << SUB_BUCKET_BITS };
+        constexpr static std::size_t BUCKET_COUNT{ (64 - SUB_BUCKET_BITS) * SUB_BUCKETS + SUB_BUCKETS };
+
+    public:
+        [[nodiscard]] constexpr static std::size_t BucketIndex(std::uint64_t value) noexcept
+        {
+            if (value < SUB_BUCKETS)
+            {
+                return static_cast<std::size_t>(value);
+            }
+
+            const auto shift{ static_cast<std::size_t>(std::bit_width(value)) - 1 - SUB_BUCKET_BITS };
+            const auto sub_bucket{ static_cast<std::size_t>(value >> shift) & (SUB_BUCKETS - 1) };
+
+            return (shift + 1) * SUB_BUCKETS + sub_bucket;
+        }
+
+        // The largest value which falls into the bucket
+        [[nodiscard]] constexpr static std::uint64_t BucketUpperBound(std::size_t index) noexcept
+        {
+            if (index < SUB_BUCKETS)
+            {
+                return index;
+            }
+
+            const auto shift{ index / SUB_BUCKETS - 1 };
+            const auto lower_bound{ static_cast<std::uint64_t>(SUB_BUCKETS + index % SUB_BUCKETS) << shift };
+
+            return lower_bound + ((std::uint64_t{ 1 } << shift) - 1);
+        }
+
+        void Record(std::uint64_t value) noexcept
+        {
+            mBuckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void AddTo(std::array<std::uint64_t, BUCKET_COUNT>& buckets) const noexcept
+        {
+            for (std::size_t i{}; i < BUCKET_COUNT; ++i)
+            {
+                buckets[i] += mBuckets[i].load(std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> mBuckets{};
+    };
+
+    struct Snapshot
+    {
+        std::uint64_t Pushes{};
+        std::uint64_t Pops{};
+        std::uint64_t FailedFull{};
+        std::uint64_t FailedEmpty{};
+        std::uint64_t CasRetries{};
+
+        std::array<std::uint64_t, LogHistogram::BUCKET_COUNT> SojournNs{}; // enqueue -> dequeue time
+
+        // p in [0, 1], e.g. 0.999 -> p99.9 sojourn time in nanoseconds (upper bound of the bucket)
+        [[nodiscard]] std::uint64_t SojournPercentile(double p) const noexcept
+        {
+            std::uint64_t total{};
+            for (auto count : SojournNs)
+            {
+                total += count;
+            }
+
+            const auto rank{ static_cast<std::uint64_t>(p * static_cast<double>(total)) };
+
+            std::uint64_t seen{};
+            for (std::size_t i{}; i < LogHistogram::BUCKET_COUNT; ++i)
+            {
+                seen += SojournNs[i];
+                if (seen > rank)
+                {
+                    return LogHistogram::BucketUpperBound(i);
+                }
+            }
+
+            return 0;
+        }
+    };
+
+    // Every thread counts into its own cache line isolated block, a snapshot sums all blocks without stopping the queue.
+    // Threads are mapped to blocks by a thread id modulo MAX_THREADS, so the counters are still atomic (relaxed).
+    class QueueStats
+    {
+    public:
+        constexpr static std::size_t MAX_THREADS{ 64 };
+
+        struct Stamp
+        {
+            std::uint64_t EnqueueNs;
+        };
+
+    public:
+        QueueStats() :
+            mThreadStats{ std::make_unique<ThreadStats[]>(MAX_THREADS) }
+        { }
+
+        inline void OnPush(Stamp& stamp) noexcept
+        {
+            stamp.EnqueueNs = Now();
+            Current().Pushes.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        inline void OnPop(const Stamp& stamp) noexcept
+        {
+            auto& thread_stats{ Current() };
+
+            thread_stats.Pops.fetch_add(1, std::memory_order_relaxed);
+            thread_stats.Sojourn.Record(Now() - stamp.EnqueueNs);
+        }
+
+        inline void OnFull() noexcept { Current().FailedFull.fetch_add(1, std::memory_order_relaxed); }
+        inline void OnEmpty() noexcept { Current().FailedEmpty.fetch_add(1, std::memory_order_relaxed); }
+        inline void OnCasRetry() noexcept { Current().CasRetries.fetch_add(1, std::memory_order_relaxed); }
+
+        [[nodiscard]] Snapshot TakeSnapshot() const noexcept
+        {
+            Snapshot snapshot{};
+
+            for (std::size_t i{}; i < MAX_THREADS; ++i)
+            {
+                const auto& thread_stats{ mThreadStats[i] };
+
+                snapshot.Pushes += thread_stats.Pushes.load(std::memory_order_relaxed);
+                snapshot.Pops += thread_stats.Pops.load(std::memory_order_relaxed);
+                snapshot.FailedFull += thread_stats.FailedFull.load(std::memory_order_relaxed);
+                snapshot.FailedEmpty += thread_stats.FailedEmpty.load(std::memory_order_relaxed);
+                snapshot.CasRetries += thread_stats.CasRetries.load(std::memory_order_relaxed);
+
+                thread_stats.Sojourn.AddTo(snapshot.SojournNs);
+            }
+
+            return snapshot;
+        }
+
+    private:
+        struct alignas(std::hardware_destructive_interference_size) ThreadStats
+        {
+            std::atomic<std::uint64_t> Pushes{};
+            std::atomic<std::uint64_t> Pops{};
+            std::atomic<std::uint64_t> FailedFull{};
+            std::atomic<std::uint64_t> FailedEmpty{};
+            std::atomic<std::uint64_t> CasRetries{};
+
+            LogHistogram Sojourn{};
+        };
+
+        [[nodiscard]] inline ThreadStats& Current() noexcept
+        {
+            static std::atomic<std::size_t> thread_counter{};
+            thread_local const std::size_t thread_index{ thread_counter.fetch_add(1, std::memory_order_relaxed) % MAX_THREADS };
+
+            return mThreadStats[thread_index];
+        }
+
+        [[nodiscard]] static std::uint64_t Now() noexcept
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+    private:
+        std::unique_ptr<ThreadStats[]> mThreadStats;
+    };
+}
@@ -0,0 +1,181 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <tracy/Tracy.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+// Optional Tracy instrumentation for LFQueue and abstract_task::Task, only for targets which link Tracy::TracyClient.
+// Without TRACY_ENABLE the Tracy macros are empty and everything below is a plain forwarding call.
+namespace queue_tracy
+{
+    // Bounds the overhead: only one of every Period() plots/zones is recorded (1 -> everything, 0 -> nothing)
+    class Sampling
+    {
+    public:
+        static void SetPeriod(std::uint32_t period) noexcept
+        {
+            Period().store(period, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] static bool ShouldSample() noexcept
+        {
+            const auto period{ Period().load(std::memory_order_relaxed) };
+            if (period == 0)
+            {
+                return false;
+            }
+
+            thread_local std::uint32_t counter{};
+            return ++counter % period == 0;
+        }
+
+    private:
+        [[nodiscard]] static std::atomic<std::uint32_t>& Period() noexcept
+        {
+            static std::atomic<std::uint32_t> period{ 1 };
+            return period;
+        }
+    };
+
+    // Stats policy for LFQueue (the Stats parameter), puts a message on the timeline when one push/pop
+    // needs StormThreshold CAS retries in a row
+    template <std::uint32_t StormThreshold = 32>
+    class TracyStats
+    {
+    public:
+        struct Stamp {};
+
+    public:
+        inline void OnPush([[maybe_unused]] Stamp& stamp) noexcept { Retries() = 0; }
+        inline void OnPop([[maybe_unused]] const Stamp& stamp) noexcept { Retries() = 0; }
+
+        inline void OnFull() noexcept { Retries() = 0; }
+        inline void OnEmpty() noexcept { Retries() = 0; }
+
+        inline void OnCasRetry() noexcept
+        {
+            if (++Retries() == StormThreshold)
+            {
+                TracyMessageLC("LFQueue: CAS retry storm", tracy::Color::Red);
+            }
+        }
+
+    private:
+        [[nodiscard]] static std::uint32_t& Retries() noexcept
+        {
+            thread_local std::uint32_t retries{};
+            return retries;
+        }
+    };
+
+    // Forwards to Queue and plots its depth (Queue::ApproxSize()) after sampled pushes/pops.
+    // plot_name must outlive the profiling session (Tracy keeps the pointer), use a string literal.
+    template <typename Queue>
+    class TracedQueue
+    {
+    public:
+        using value_type = typename Queue::value_type;
+
+    public:
+        template <typename... QueueArgs>
+        explicit TracedQueue(const char* plot_name, QueueArgs&&... queue_args) :
+            mQueue{ std::forward<QueueArgs>(queue_args)... },
+            mPlotName{ plot_name }
+        {
+            TracyPlotConfig(mPlotName, tracy::PlotFormatType::Number, true, true, 0);
+        }
+
+        [[nodiscard]] bool TryPush(value_type& value)
+        {
+            const auto is_pushed{ mQueue.TryPush(value) };
+            PlotSize();
+
+            return is_pushed;
+        }
+
+        template <typename... Args>
+        [[nodiscard]] bool TryEmplace(Args&&... args) noexcept
+        {
+            const auto is_pushed{ mQueue.TryEmplace(std::forward<Args>(args)...) };
+            PlotSize();
+
+            return is_pushed;
+        }
+
+        [[nodiscard]] bool TryPop(value_type& value)
+        {
+            const auto is_popped{ mQueue.TryPop(value) };
+            PlotSize();
+
+            return is_popped;
+        }
+
+        [[nodiscard]] inline bool IsEmpty() const noexcept
+        {
+            return mQueue.IsEmpty();
+        }
+
+        [[nodiscard]] inline std::size_t ApproxSize() const noexcept
+        {
+            return mQueue.ApproxSize();
+        }
+
+        [[nodiscard]] constexpr std::size_t Capacity() const noexcept
+        {
+            return mQueue.Capacity();
+        }
+
+        [[nodiscard]] inline Queue& Underlying() noexcept
+        {
+            return mQueue;
+        }
+
+    private:
+        inline void PlotSize() const noexcept
+        {
+            if (Sampling::ShouldSample())
+            {
+                TracyPlot(mPlotName, static_cast<std::int64_t>(mQueue.ApproxSize()));
+            }
+        }
+
+    private:
+        Queue mQueue;
+        [[maybe_unused]] const char* mPlotName;
+    };
+
+    // Runs the task, sampled runs get a zone named after the stored callable type
+    template <typename TaskType, typename... Args>
+    decltype(auto) RunTask(TaskType& task, Args&&... args)
+    {
+        ZoneNamedN(task_zone, "Task", Sampling::ShouldSample());
+        ZoneNameV(task_zone, task.TypeName().data(), task.TypeName().size());
+
+        return task(std::forward<Args>(args)...);
+    }
+}
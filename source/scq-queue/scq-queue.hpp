@@ -0,0 +1,293 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <bit>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+#include <lock-free-bounded-queue/lock-free-bounded-queue.hpp>
+
+namespace scq
+{
+    // Nikolaev's SCQ index ring: holds up to N = 2^Order indices from [0, N) in 2N entries.
+    // Head/Tail are only ever advanced with fetch_add, every entry is { Cycle | IsSafe | Index } in one 64-bit word.
+    // Threshold bounds how long dequeuers keep trying on a ring which looks empty (livelock freedom).
+    template <std::size_t Order>
+    class Ring
+    {
+        constexpr static std::uint64_t N{ std::uint64_t{ 1 } << Order };
+        constexpr static std::uint64_t RING_SIZE{ 2 * N };
+
+        constexpr static std::uint64_t INDEX_MASK{ RING_SIZE - 1 }; // Order + 1 bits
+        constexpr static std::uint64_t SAFE_BIT{ RING_SIZE };
+        constexpr static std::size_t CYCLE_SHIFT{ Order + 2 };      // the cycle field wraps after 2^63 operations
+
+        constexpr static std::int64_t THRESHOLD{ 3 * static_cast<std::int64_t>(N) - 1 };
+
+        // entries are 8 bytes: neighbouring positions are spread over different cache lines (layout::Packed remap)
+        constexpr static std::size_t ENTRIES_PER_LINE{ std::hardware_destructive_interference_size / sizeof(std::uint64_t) };
+        constexpr static std::size_t LINE_COUNT{ RING_SIZE >= ENTRIES_PER_LINE ? RING_SIZE / ENTRIES_PER_LINE : 1 };
+        constexpr static std::size_t SLOTS_PER_LINE{ RING_SIZE / LINE_COUNT };
+
+    public:
+        // all index bits set -> OR-ing it into an entry consumes the index
+        constexpr static std::uint64_t EMPTY{ RING_SIZE - 1 };
+
+    public:
+        Ring() noexcept
+        {
+            for (auto& entry : mEntries)
+            {
+                entry.store(Pack(0, true, EMPTY), std::memory_order_relaxed);
+            }
+        }
+
+        void Enqueue(std::uint64_t index) noexcept
+        {
+            for (;;)
+            {
+                const auto tail{ mTail.fetch_add(1, std::memory_order_acq_rel) };
+                const auto tail_cycle{ Cycle(tail) };
+
+                auto& entry{ EntryAt(tail) };
+                auto value{ entry.load(std::memory_order_acquire) };
+
+                // a free entry of an older cycle, usable if it is safe or no dequeuer has passed this position yet
+                while (EntryCycle(value) < tail_cycle && (value & INDEX_MASK) == EMPTY &&
+                       ((value & SAFE_BIT) != 0 || mHead.load(std::memory_order_acquire) <= tail))
+                {
+                    if (entry.compare_exchange_weak(value, Pack(tail_cycle, true, index), std::memory_order_acq_rel, std::memory_order_acquire))
+                    {
+                        if (mThreshold.load(std::memory_order_relaxed) != THRESHOLD)
+                        {
+                            mThreshold.store(THRESHOLD, std::memory_order_release);
+                        }
+
+                        return;
+                    }
+                }
+            }
+        }
+
+        // Returns EMPTY if there is nothing to dequeue
+        [[nodiscard]] std::uint64_t Dequeue() noexcept
+        {
+            if (mThreshold.load(std::memory_order_acquire) < 0)
+            {
+                return EMPTY;
+            }
+
+            for (;;)
+            {
+                const auto head{ mHead.fetch_add(1, std::memory_order_acq_rel) };
+                const auto head_cycle{ Cycle(head) };
+
+                auto& entry{ EntryAt(head) };
+                auto value{ entry.load(std::memory_order_acquire) };
+
+                for (;;)
+                {
+                    const auto entry_cycle{ EntryCycle(value) };
+                    if (entry_cycle == head_cycle)
+                    {
+                        entry.fetch_or(EMPTY, std::memory_order_acq_rel);
+                        return value & INDEX_MASK;
+                    }
+
+                    // we came too early: an empty entry is moved to our cycle (a late enqueuer can't use it anymore),
+                    // an occupied one of an older cycle is marked unsafe
+                    const auto replacement{ (value & INDEX_MASK) == EMPTY ? Pack(head_cycle, (value & SAFE_BIT) != 0, EMPTY) : Pack(entry_cycle, false, value & INDEX_MASK) };
+
+                    if (entry_cycle < head_cycle && !entry.compare_exchange_weak(value, replacement, std::memory_order_acq_rel, std::memory_order_acquire))
+                    {
+                        continue;
+                    }
+
+                    break;
+                }
+
+                const auto tail{ mTail.load(std::memory_order_acquire) };
+                if (tail <= head + 1)
+                {
+                    CatchUp(tail, head + 1);
+                    mThreshold.fetch_sub(1, std::memory_order_acq_rel);
+
+                    return EMPTY;
+                }
+
+                if (mThreshold.fetch_sub(1, std::memory_order_acq_rel) <= 0)
+                {
+                    return EMPTY;
+                }
+            }
+        }
+
+        // Exact when nobody enqueues/dequeues and the last dequeue attempt has caught the tail up
+        [[nodiscard]] inline bool IsEmpty() const noexcept
+        {
+            return mThreshold.load(std::memory_order_acquire) < 0 || mHead.load(std::memory_order_acquire) >= mTail.load(std::memory_order_acquire);
+        }
+
+    private:
+        [[nodiscard]] constexpr static std::uint64_t Cycle(std::uint64_t position) noexcept
+        {
+            return position >> (Order + 1);
+        }
+
+        [[nodiscard]] constexpr static std::uint64_t EntryCycle(std::uint64_t entry) noexcept
+        {
+            return entry >> CYCLE_SHIFT;
+        }
+
+        [[nodiscard]] constexpr static std::uint64_t Pack(std::uint64_t cycle, bool is_safe, std::uint64_t index) noexcept
+        {
+            return (cycle << CYCLE_SHIFT) | (is_safe ? SAFE_BIT : 0) | index;
+        }
+
+        [[nodiscard]] inline std::atomic<std::uint64_t>& EntryAt(std::uint64_t position) noexcept
+        {
+            constexpr auto column_shift{ static_cast<std::size_t>(std::countr_zero(LINE_COUNT)) };
+            return mEntries[layout::PackedIndex(static_cast<std::size_t>(position & INDEX_MASK), LINE_COUNT - 1, column_shift, SLOTS_PER_LINE)];
+        }
+
+        // The dequeuers overtook the tail: move it to head, otherwise enqueuers would keep landing on dead positions
+        void CatchUp(std::uint64_t tail, std::uint64_t head) noexcept
+        {
+            while (!mTail.compare_exchange_weak(tail, head, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                head = mHead.load(std::memory_order_acquire);
+                if (tail >= head)
+                {
+                    break;
+                }
+            }
+        }
+
+    private:
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::uint64_t> mHead{ RING_SIZE };
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::uint64_t> mTail{ RING_SIZE };
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::int64_t> mThreshold{ -1 };
+
+        alignas(std::hardware_destructive_interference_size) std::array<std::atomic<std::uint64_t>, RING_SIZE> mEntries;
+    };
+}
+
+// Bounded MPMC FIFO queue on SCQ rings (an alternative to the CAS-based LFQueue engine):
+// free slot indices circulate through the "free" ring, filled ones through the "allocated" ring.
+// Both rings only use fetch_add on their indices, so contended pushes/pops don't retry CAS on a shared counter.
+template <typename T, std::size_t Size>
+class SCQueue
+{
+    static_assert(Size >= 4, "Size must be >= 4");
+    static_assert(std::has_single_bit(Size), "Size must be power of two");
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>, "T must be nothrow movable (TryPop move-assigns into the output)");
+
+    using ring_t = scq::Ring<static_cast<std::size_t>(std::countr_zero(Size))>;
+
+    struct alignas(std::hardware_destructive_interference_size) Slot
+    {
+        [[nodiscard]] T* Value() noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(Storage));
+        }
+
+        alignas(T) std::byte Storage[sizeof(T)];
+    };
+
+public:
+    using value_type = T;
+
+public:
+    SCQueue() noexcept
+    {
+        for (std::size_t i{}; i < Size; ++i)
+        {
+            mFree.Enqueue(i);
+        }
+    }
+
+    ~SCQueue() noexcept
+    {
+        for (auto index{ mAllocated.Dequeue() }; index != ring_t::EMPTY; index = mAllocated.Dequeue())
+        {
+            std::destroy_at(mSlots[index].Value());
+        }
+    }
+
+    SCQueue(const SCQueue& other) = delete;
+    SCQueue& operator=(const SCQueue& other) = delete;
+
+    [[nodiscard]] bool TryPush(T& value) noexcept
+    {
+        const auto index{ mFree.Dequeue() };
+        if (index == ring_t::EMPTY) // the queue is full
+        {
+            return false;
+        }
+
+        std::construct_at(mSlots[index].Value(), std::move(value));
+        mAllocated.Enqueue(index);
+
+        return true;
+    }
+
+    [[nodiscard]] bool TryPop(T& value) noexcept
+    {
+        const auto index{ mAllocated.Dequeue() };
+        if (index == ring_t::EMPTY)
+        {
+            return false;
+        }
+
+        auto* stored_value{ mSlots[index].Value() };
+
+        value = std::move(*stored_value);
+        std::destroy_at(stored_value);
+
+        mFree.Enqueue(index);
+        return true;
+    }
+
+    // See scq::Ring::IsEmpty, a failed TryPop makes it exact again
+    [[nodiscard]] inline bool IsEmpty() const noexcept
+    {
+        return mAllocated.IsEmpty();
+    }
+
+    [[nodiscard]] constexpr std::size_t Capacity() const noexcept
+    {
+        return Size;
+    }
+
+private:
+    ring_t mAllocated;
+    ring_t mFree;
+
+    std::array<Slot, Size> mSlots;
+};
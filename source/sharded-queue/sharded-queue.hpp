@@ -0,0 +1,159 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <algorithm>
+
+#include <lock-free-bounded-queue/lock-free-bounded-queue.hpp>
+
+// ShardCount LFQueue shards behind one queue interface, so threads don't all hit the same head/tail pair.
+// Every thread has a home shard (assigned round-robin on first use, or passed explicitly):
+// - TryPush -> the home shard, then the others if it is full
+// - TryPop  -> the home shard, then steals from the others
+// FIFO holds per shard only. Emptiness is still linearizable: a failed TryPop/IsEmpty double-collects the shards'
+// push positions and only reports empty if no push was claimed while the shards were inspected.
+// Spilling and stealing make every shard multi-producer and multi-consumer, so the shards are always MPMC.
+template <typename T, std::size_t ShardSize, std::size_t ShardCount>
+class ShardedLFQueue
+{
+    static_assert(ShardCount > 0, "ShardCount must be > 0");
+
+    using shard_t = LFQueue<T, ShardSize, concurrency::MPMC>;
+    using positions_t = std::array<std::size_t, ShardCount>;
+
+public:
+    using value_type = T;
+
+public:
+    ShardedLFQueue() = default;
+    ~ShardedLFQueue() noexcept = default;
+
+    ShardedLFQueue(const ShardedLFQueue& other) = delete;
+    ShardedLFQueue& operator=(const ShardedLFQueue& other) = delete;
+
+    [[nodiscard]] bool TryPush(T& value)
+    {
+        return TryPush(value, HomeShard());
+    }
+
+    [[nodiscard]] bool TryPush(T& value, std::size_t home_shard)
+    {
+        for (std::size_t i{}; i < ShardCount; ++i)
+        {
+            if (mShards[(home_shard + i) % ShardCount].TryPush(value))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] bool TryPop(T& value)
+    {
+        return TryPop(value, HomeShard());
+    }
+
+    [[nodiscard]] bool TryPop(T& value, std::size_t home_shard)
+    {
+        for (;;)
+        {
+            const auto positions{ CollectPushPositions() };
+
+            for (std::size_t i{}; i < ShardCount; ++i)
+            {
+                if (mShards[(home_shard + i) % ShardCount].TryPop(value))
+                {
+                    return true;
+                }
+            }
+
+            // every shard was empty when we looked at it and nothing was pushed since -> all of them are empty now
+            if (positions == CollectPushPositions())
+            {
+                return false;
+            }
+        }
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        for (;;)
+        {
+            const auto positions{ CollectPushPositions() };
+
+            if (!std::ranges::all_of(mShards, [](const shard_t& shard) -> bool { return shard.IsEmpty(); }))
+            {
+                return false;
+            }
+
+            if (positions == CollectPushPositions())
+            {
+                return true;
+            }
+        }
+    }
+
+    [[nodiscard]] inline std::size_t ApproxSize() const noexcept
+    {
+        std::size_t size{};
+        for (const auto& shard : mShards)
+        {
+            size += shard.ApproxSize();
+        }
+
+        return size;
+    }
+
+    [[nodiscard]] constexpr std::size_t Capacity() const noexcept
+    {
+        return ShardSize * ShardCount;
+    }
+
+    // The shard this thread pushes to and pops from first
+    [[nodiscard]] static std::size_t HomeShard() noexcept
+    {
+        static std::atomic<std::size_t> thread_counter{};
+        thread_local const std::size_t thread_index{ thread_counter.fetch_add(1, std::memory_order_relaxed) };
+
+        return thread_index % ShardCount;
+    }
+
+private:
+    [[nodiscard]] positions_t CollectPushPositions() const noexcept
+    {
+        positions_t positions{};
+        for (std::size_t i{}; i < ShardCount; ++i)
+        {
+            positions[i] = mShards[i].PushPosition();
+        }
+
+        return positions;
+    }
+
+private:
+    std::array<shard_t, ShardCount> mShards;
+};
@@ -0,0 +1,347 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#if defined(__linux__)
+
+#include <new>
+#include <bit>
+#include <atomic>
+#include <string>
+#include <cerrno>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// MPMC queue for trivially copyable values in a POSIX shared memory object, so processes exchange values directly.
+// The region only holds offsets-free data (header + slot array right after it), every process maps it at its own address.
+// Create() makes and initializes a new region, Open() attaches to an existing one and checks its header:
+// magic, layout version, slot type size/alignment and capacity. Errors are reported as std::system_error.
+template <typename T>
+class ShmLFQueue
+{
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "the queue atomics must be lock-free to work across processes");
+
+    constexpr static std::uint64_t MAGIC{ 0x4C46'5155'4555'4531 }; // "LFQUEUE1"
+    constexpr static std::uint32_t VERSION{ 1 };
+
+    struct alignas(std::hardware_destructive_interference_size) Slot
+    {
+        std::atomic<std::uint64_t> Sequence;
+        T Value;
+    };
+
+    struct Header
+    {
+        std::atomic<std::uint64_t> Magic; // written last by Create(), Open() doesn't attach before
+        std::uint32_t Version;
+        std::uint32_t SlotSize;
+        std::uint32_t ValueSize;
+        std::uint32_t ValueAlignment;
+        std::uint64_t Capacity;
+        std::uint64_t Mask;
+
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::uint64_t> Head;
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::uint64_t> Tail;
+    };
+
+    // the slots start on the first cache line after the header
+    constexpr static std::size_t SLOTS_OFFSET{ (sizeof(Header) + alignof(Slot) - 1) & ~(alignof(Slot) - 1) };
+
+public:
+    using value_type = T;
+
+public:
+    // Creates the shared memory object (fails if it already exists), capacity must be a power of two > 2
+    [[nodiscard]] static ShmLFQueue Create(std::string_view name, std::size_t capacity)
+    {
+        if (capacity <= 2 || !std::has_single_bit(capacity))
+        {
+            throw std::system_error{ std::make_error_code(std::errc::invalid_argument), "ShmLFQueue: capacity must be power of two > 2" };
+        }
+
+        const std::string object_name{ name };
+        const auto descriptor{ ::shm_open(object_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600) };
+        if (descriptor == -1)
+        {
+            throw std::system_error{ errno, std::system_category(), "ShmLFQueue: shm_open" };
+        }
+
+        const auto mapping_size{ MappingSize(capacity) };
+        if (::ftruncate(descriptor, static_cast<off_t>(mapping_size)) == -1)
+        {
+            const auto error{ errno };
+
+            ::close(descriptor);
+            ::shm_unlink(object_name.c_str());
+
+            throw std::system_error{ error, std::system_category(), "ShmLFQueue: ftruncate" };
+        }
+
+        void* region{};
+        try
+        {
+            region = Map(descriptor, mapping_size);
+        }
+        catch (...)
+        {
+            ::shm_unlink(object_name.c_str());
+            throw;
+        }
+
+        ShmLFQueue queue{ region, mapping_size };
+
+        auto* header{ ::new (queue.mRegion) Header{} };
+        header->Version = VERSION;
+        header->SlotSize = sizeof(Slot);
+        header->ValueSize = sizeof(T);
+        header->ValueAlignment = alignof(T);
+        header->Capacity = capacity;
+        header->Mask = capacity - 1;
+
+        for (std::size_t i{}; i < capacity; ++i)
+        {
+            ::new (static_cast<void*>(queue.SlotsBegin() + i)) Slot{};
+            queue.SlotsBegin()[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+
+        header->Magic.store(MAGIC, std::memory_order_release);
+        return queue;
+    }
+
+    // Attaches to a region made by Create() (in this or another process)
+    [[nodiscard]] static ShmLFQueue Open(std::string_view name)
+    {
+        const std::string object_name{ name };
+        const auto descriptor{ ::shm_open(object_name.c_str(), O_RDWR, 0600) };
+        if (descriptor == -1)
+        {
+            throw std::system_error{ errno, std::system_category(), "ShmLFQueue: shm_open" };
+        }
+
+        struct stat status{};
+        if (::fstat(descriptor, &status) == -1)
+        {
+            const auto error{ errno };
+            ::close(descriptor);
+
+            throw std::system_error{ error, std::system_category(), "ShmLFQueue: fstat" };
+        }
+
+        const auto mapping_size{ static_cast<std::size_t>(status.st_size) };
+        if (mapping_size < SLOTS_OFFSET)
+        {
+            ::close(descriptor);
+            throw std::system_error{ std::make_error_code(std::errc::resource_unavailable_try_again), "ShmLFQueue: the region is not initialized yet" };
+        }
+
+        ShmLFQueue queue{ Map(descriptor, mapping_size), mapping_size };
+
+        const auto* header{ queue.GetHeader() };
+        if (header->Magic.load(std::memory_order_acquire) != MAGIC)
+        {
+            throw std::system_error{ std::make_error_code(std::errc::resource_unavailable_try_again), "ShmLFQueue: the region is not initialized yet" };
+        }
+
+        if (header->Version != VERSION)
+        {
+            throw std::system_error{ std::make_error_code(std::errc::protocol_not_supported), "ShmLFQueue: layout version mismatch" };
+        }
+
+        if (header->SlotSize != sizeof(Slot) || header->ValueSize != sizeof(T) || header->ValueAlignment != alignof(T))
+        {
+            throw std::system_error{ std::make_error_code(std::errc::invalid_argument), "ShmLFQueue: value type mismatch" };
+        }
+
+        // the slots are indexed with Mask -> a stale or corrupted header must not point outside the mapping
+        const auto capacity{ header->Capacity };
+        if (capacity <= 2 || !std::has_single_bit(capacity) || header->Mask != capacity - 1 ||
+            capacity > (mapping_size - SLOTS_OFFSET) / sizeof(Slot))
+        {
+            throw std::system_error{ std::make_error_code(std::errc::invalid_argument), "ShmLFQueue: capacity mismatch" };
+        }
+
+        return queue;
+    }
+
+    // Removes the name, processes which are attached keep their mapping
+    static void Remove(std::string_view name) noexcept
+    {
+        const std::string object_name{ name };
+        ::shm_unlink(object_name.c_str());
+    }
+
+    ~ShmLFQueue() noexcept
+    {
+        if (mRegion != nullptr)
+        {
+            ::munmap(mRegion, mMappingSize);
+        }
+    }
+
+    ShmLFQueue(const ShmLFQueue& other) = delete;
+    ShmLFQueue& operator=(const ShmLFQueue& other) = delete;
+
+    ShmLFQueue(ShmLFQueue&& other) noexcept :
+        mRegion{ std::exchange(other.mRegion, nullptr) },
+        mMappingSize{ std::exchange(other.mMappingSize, 0) }
+    { }
+
+    ShmLFQueue& operator=(ShmLFQueue&& other) noexcept
+    {
+        if (this != &other)
+        {
+            this->~ShmLFQueue();
+
+            mRegion = std::exchange(other.mRegion, nullptr);
+            mMappingSize = std::exchange(other.mMappingSize, 0);
+        }
+
+        return *this;
+    }
+
+    [[nodiscard]] bool TryPush(const T& value) noexcept
+    {
+        auto* header{ GetHeader() };
+        auto position{ header->Tail.load(std::memory_order_relaxed) };
+
+        for (;;)
+        {
+            auto& slot{ SlotsBegin()[position & header->Mask] };
+            const auto difference{ static_cast<std::int64_t>(slot.Sequence.load(std::memory_order_acquire)) - static_cast<std::int64_t>(position) };
+
+            if (difference == 0)
+            {
+                if (header->Tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.Value = value;
+                    slot.Sequence.store(position + 1, std::memory_order_release);
+
+                    return true;
+                }
+            }
+            else if (difference < 0) // the queue is full
+            {
+                return false;
+            }
+            else
+            {
+                position = header->Tail.load(std::memory_order_relaxed); // someone has already taken this slot
+            }
+        }
+    }
+
+    [[nodiscard]] bool TryPop(T& value) noexcept
+    {
+        auto* header{ GetHeader() };
+        auto position{ header->Head.load(std::memory_order_relaxed) };
+
+        for (;;)
+        {
+            auto& slot{ SlotsBegin()[position & header->Mask] };
+            const auto difference{ static_cast<std::int64_t>(slot.Sequence.load(std::memory_order_acquire)) - static_cast<std::int64_t>(position + 1) };
+
+            if (difference == 0)
+            {
+                if (header->Head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    value = slot.Value;
+                    slot.Sequence.store(position + header->Capacity, std::memory_order_release);
+
+                    return true;
+                }
+            }
+            else if (difference < 0) // the queue is empty
+            {
+                return false;
+            }
+            else
+            {
+                position = header->Head.load(std::memory_order_relaxed); // someone has already taken this slot
+            }
+        }
+    }
+
+    [[nodiscard]] inline bool IsEmpty() const noexcept
+    {
+        const auto* header{ GetHeader() };
+        return header->Head.load(std::memory_order_acquire) == header->Tail.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] inline std::size_t Capacity() const noexcept
+    {
+        return GetHeader()->Capacity;
+    }
+
+private:
+    ShmLFQueue(void* region, std::size_t mapping_size) noexcept :
+        mRegion{ region },
+        mMappingSize{ mapping_size }
+    { }
+
+    [[nodiscard]] constexpr static std::size_t MappingSize(std::size_t capacity) noexcept
+    {
+        return SLOTS_OFFSET + capacity * sizeof(Slot);
+    }
+
+    // The descriptor isn't needed once the region is mapped
+    [[nodiscard]] static void* Map(int descriptor, std::size_t mapping_size)
+    {
+        void* region{ ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0) };
+        const auto error{ errno };
+
+        ::close(descriptor);
+
+        if (region == MAP_FAILED)
+        {
+            throw std::system_error{ error, std::system_category(), "ShmLFQueue: mmap" };
+        }
+
+        return region;
+    }
+
+    [[nodiscard]] inline Header* GetHeader() const noexcept
+    {
+        return std::launder(static_cast<Header*>(mRegion));
+    }
+
+    [[nodiscard]] inline Slot* SlotsBegin() const noexcept
+    {
+        return std::launder(reinterpret_cast<Slot*>(static_cast<std::byte*>(mRegion) + SLOTS_OFFSET));
+    }
+
+private:
+    void* mRegion;
+    std::size_t mMappingSize;
+};
+
+#endif
@@ -0,0 +1,197 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <exception>
+
+#include <abstract-task/abstract-task.hpp>
+#include <event-count/event-count.hpp>
+
+namespace executor
+{
+    // Reusable DAG of tasks run on a ThreadPool:
+    // - every node keeps an atomic count of unfinished predecessors, the one who finishes the last of them posts the node
+    // - nobody blocks on futures inside the graph, a worker only ever picks up nodes which are ready to run
+    // - the graph is built once, Run() only resets the counters, so re-running it doesn't allocate
+    class TaskGraph
+    {
+    public:
+        using node_id = std::size_t;
+        using task_t = abstract_task::Task<void()>;
+
+    public:
+        TaskGraph() noexcept = default;
+
+        // Waits for the current run, its exception is dropped
+        ~TaskGraph() noexcept
+        {
+            WaitFinished();
+        }
+
+        TaskGraph(const TaskGraph& other) = delete;
+        TaskGraph& operator=(const TaskGraph& other) = delete;
+
+        // The function is called on every Run()
+        template <typename FunctionType>
+        node_id Emplace(FunctionType&& function)
+        {
+            mNodes.push_back(std::make_unique<Node>(std::forward<FunctionType>(function)));
+            return std::size(mNodes) - 1;
+        }
+
+        // before -> after: after starts when before (and all its other predecessors) have finished, the graph must stay acyclic
+        void Precede(node_id before, node_id after)
+        {
+            mNodes[before]->Successors.push_back(mNodes[after].get());
+            ++mNodes[after]->PredecessorCount;
+        }
+
+        // Posts the nodes without predecessors, the previous run must have been waited for
+        template <typename Pool>
+        void Run(Pool& pool)
+        {
+            mException = nullptr;
+            mIsFailed.store(false, std::memory_order_relaxed);
+
+            for (auto&& node : mNodes)
+            {
+                node->Pending.store(node->PredecessorCount, std::memory_order_relaxed);
+            }
+
+            if (std::empty(mNodes))
+            {
+                return;
+            }
+
+            mIsFinished.store(false, std::memory_order_relaxed);
+            mRemaining.store(static_cast<std::uint32_t>(std::size(mNodes)), std::memory_order_release);
+
+            for (auto&& node : mNodes)
+            {
+                if (node->PredecessorCount == 0)
+                {
+                    Post(pool, *node);
+                }
+            }
+        }
+
+        // Blocks until every node of the current run has finished, rethrows the first exception of a node.
+        // Must not be called from a worker of the pool: it would stop running the nodes it waits for.
+        void Wait()
+        {
+            WaitFinished();
+
+            if (mException != nullptr)
+            {
+                std::rethrow_exception(std::exchange(mException, nullptr));
+            }
+        }
+
+        [[nodiscard]] inline std::size_t NodeCount() const noexcept
+        {
+            return std::size(mNodes);
+        }
+
+    private:
+        struct alignas(std::hardware_destructive_interference_size) Node
+        {
+            template <typename FunctionType>
+            explicit Node(FunctionType&& function) : 
+                Body{ std::forward<FunctionType>(function) }
+            { }
+
+            std::atomic<std::uint32_t> Pending{};
+
+            task_t Body;
+            std::vector<Node*> Successors;
+            std::uint32_t PredecessorCount{};
+        };
+
+        void WaitFinished() noexcept
+        {
+            for (auto remaining{ mRemaining.load(std::memory_order_acquire) }; remaining != 0; remaining = mRemaining.load(std::memory_order_acquire))
+            {
+                mRemaining.wait(remaining, std::memory_order_acquire);
+            }
+
+            // the last node still touches the graph while notifying, the graph may be destroyed right after Wait()
+            while (!mIsFinished.load(std::memory_order_acquire))
+            {
+                synchronization::CpuRelax();
+            }
+        }
+
+        template <typename Pool>
+        void Post(Pool& pool, Node& node)
+        {
+            // three pointers, stays in the inline storage of the pool task
+            pool.Post([&pool, this, &node]() -> void { Execute(pool, node); });
+        }
+
+        template <typename Pool>
+        void Execute(Pool& pool, Node& node)
+        {
+            try
+            {
+                node.Body();
+            }
+            catch (...)
+            {
+                if (!mIsFailed.exchange(true, std::memory_order_acq_rel))
+                {
+                    mException = std::current_exception();
+                }
+            }
+
+            // a failed node still releases its successors, so the run always completes
+            for (auto* successor : node.Successors)
+            {
+                if (successor->Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    Post(pool, *successor);
+                }
+            }
+
+            if (mRemaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                mRemaining.notify_all();
+                mIsFinished.store(true, std::memory_order_release);
+            }
+        }
+
+    private:
+        std::vector<std::unique_ptr<Node>> mNodes;
+
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::uint32_t> mRemaining{};
+        std::atomic<bool> mIsFinished{ true };
+
+        std::atomic<bool> mIsFailed{ false };
+        std::exception_ptr mException;
+    };
+}
@@ -0,0 +1,235 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <utility>
+
+#include <abstract-task/abstract-task.hpp>
+#include <event-count/event-count.hpp>
+#include <lock-free-bounded-queue/lock-free-bounded-queue.hpp>
+
+namespace executor
+{
+    // Work-stealing thread pool:
+    // - every worker owns a local SPMC queue, tasks submitted from a worker stay on it (the owner is the only producer)
+    // - tasks submitted from other threads go to the shared global MPMC injection queue
+    // - an idle worker takes work from its local queue, then the global one, then steals from a random victim
+    template <std::size_t LocalQueueSize = 256, std::size_t GlobalQueueSize = 4'096>
+    class ThreadPool
+    {
+    public:
+        using task_t = abstract_task::Task<std::int32_t()>;
+
+    public:
+        explicit ThreadPool(std::size_t thread_count = std::thread::hardware_concurrency())
+        {
+            thread_count = std::max(thread_count, std::size_t{ 1 });
+
+            mWorkers.reserve(thread_count);
+            for (std::size_t i{}; i < thread_count; ++i)
+            {
+                mWorkers.push_back(std::make_unique<Worker>(static_cast<std::uint32_t>(i + 1)));
+            }
+
+            for (std::size_t i{}; i < thread_count; ++i)
+            {
+                mWorkers[i]->Thread = std::thread{ &ThreadPool::Run, this, i };
+            }
+        }
+
+        ~ThreadPool() noexcept
+        {
+            Shutdown();
+        }
+
+        ThreadPool(const ThreadPool& other) = delete;
+        ThreadPool& operator=(const ThreadPool& other) = delete;
+
+        // Returns the future from abstract_task::CreateTask
+        template <typename FunctionType, typename... Args>
+        [[nodiscard]] auto Submit(FunctionType&& function, Args&&... args)
+        {
+            auto&& [task, future]{ abstract_task::CreateTask(std::forward<FunctionType>(function), std::forward<Args>(args)...) };
+            Schedule(task);
+
+            return std::move(future);
+        }
+
+        // Fire-and-forget Submit: no future and no shared state, see abstract_task::DETACHED
+        template <typename FunctionType, typename... Args>
+        void Post(FunctionType&& function, Args&&... args)
+        {
+            auto task{ abstract_task::CreateTask(abstract_task::DETACHED, std::forward<FunctionType>(function), std::forward<Args>(args)...) };
+            Schedule(task);
+        }
+
+        // Graceful: the workers finish every queued task (including the ones spawned meanwhile) and exit,
+        // nothing may be submitted from outside the pool after this call
+        void Shutdown() noexcept
+        {
+            if (mIsStopping.exchange(true, std::memory_order_acq_rel))
+            {
+                return;
+            }
+
+            mWorkAvailable.NotifyAll();
+
+            for (auto&& worker : mWorkers)
+            {
+                if (worker->Thread.joinable())
+                {
+                    worker->Thread.join();
+                }
+            }
+        }
+
+        [[nodiscard]] inline std::size_t ThreadCount() const noexcept
+        {
+            return std::size(mWorkers);
+        }
+
+    private:
+        struct alignas(std::hardware_destructive_interference_size) Worker
+        {
+            explicit Worker(std::uint32_t seed) noexcept : 
+                RandomState{ seed }
+            { }
+
+            LFQueue<task_t, LocalQueueSize, concurrency::SPMC> LocalQueue;
+            std::uint32_t RandomState;
+
+            std::thread Thread;
+        };
+
+        void Schedule(task_t& task)
+        {
+            auto* worker{ tCurrentPool == this ? mWorkers[tCurrentWorkerIndex].get() : nullptr };
+
+            if (worker != nullptr && worker->LocalQueue.TryPush(task))
+            {
+                mWorkAvailable.Notify();
+                return;
+            }
+
+            while (!mGlobalQueue.TryPush(task))
+            {
+                if (worker != nullptr) // a worker waiting for space could wait forever, run the task right away instead
+                {
+                    [[maybe_unused]] auto status{ task() };
+                    return;
+                }
+
+                std::this_thread::yield();
+            }
+
+            mWorkAvailable.Notify();
+        }
+
+        void Run(std::size_t worker_index)
+        {
+            tCurrentPool = this;
+            tCurrentWorkerIndex = worker_index;
+
+            auto& worker{ *mWorkers[worker_index] };
+            task_t task{};
+
+            for (;;)
+            {
+                if (FindTask(worker, task))
+                {
+                    [[maybe_unused]] auto status{ task() };
+                    continue;
+                }
+
+                auto key{ mWorkAvailable.PrepareWait() };
+                if (FindTask(worker, task))
+                {
+                    mWorkAvailable.CancelWait();
+
+                    [[maybe_unused]] auto status{ task() };
+                    continue;
+                }
+
+                if (mIsStopping.load(std::memory_order_acquire))
+                {
+                    mWorkAvailable.CancelWait();
+                    break;
+                }
+
+                mWorkAvailable.Wait(key);
+            }
+
+            tCurrentPool = nullptr;
+        }
+
+        [[nodiscard]] bool FindTask(Worker& worker, task_t& task)
+        {
+            if (worker.LocalQueue.TryPop(task) || mGlobalQueue.TryPop(task))
+            {
+                return true;
+            }
+
+            const auto worker_count{ std::size(mWorkers) };
+            const auto first_victim{ NextRandom(worker) % worker_count };
+
+            for (std::size_t i{}; i < worker_count; ++i)
+            {
+                auto& victim{ *mWorkers[(first_victim + i) % worker_count] };
+                if (&victim != &worker && victim.LocalQueue.TryPop(task))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // xorshift32
+        [[nodiscard]] static std::uint32_t NextRandom(Worker& worker) noexcept
+        {
+            auto state{ worker.RandomState };
+
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+
+            return worker.RandomState = state;
+        }
+
+    private:
+        inline static thread_local ThreadPool* tCurrentPool{ nullptr };
+        inline static thread_local std::size_t tCurrentWorkerIndex{};
+
+        std::vector<std::unique_ptr<Worker>> mWorkers;
+        LFQueue<task_t, GlobalQueueSize> mGlobalQueue;
+
+        alignas(std::hardware_destructive_interference_size) synchronization::EventCount mWorkAvailable;
+        alignas(std::hardware_destructive_interference_size) std::atomic<bool> mIsStopping{ false };
+    };
+}
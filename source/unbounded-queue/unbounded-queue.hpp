@@ -0,0 +1,403 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <new>
+#include <bit>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <hazard-pointer/hazard-pointer.hpp>
+
+// MPMC queue without a capacity limit: a linked list of bounded rings (segments), each one with the LFQueue slot protocol.
+// - pushes go to the tail segment, a full segment is closed (no more pushes) and a new one is linked after it
+// - pops take from the head segment, a closed and drained segment is unlinked and retired
+// Retired segments are recycled through a lock-free pool once no hazard pointer refers to them,
+// so in the steady state nothing is allocated, memory only grows during bursts (and is kept for the next one).
+template <typename T, std::size_t SegmentSize = 1'024>
+class UnboundedLFQueue
+{
+    static_assert(SegmentSize > 2, "SegmentSize must be > 2");
+    static_assert(std::has_single_bit(SegmentSize), "SegmentSize must be power of two");
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>, "T must be nothrow movable (TryPop move-assigns into the output)");
+
+    // hazard slots of one operation
+    constexpr static std::size_t SEGMENT_SLOT{ 0 };
+    constexpr static std::size_t POOL_SLOT{ 1 };
+
+    using hazard_domain_t = memory::HazardDomain<2>;
+
+    class Segment
+    {
+        constexpr static std::size_t MASK{ SegmentSize - 1 };
+        constexpr static std::size_t CLOSED{ std::size_t{ 1 } << (sizeof(std::size_t) * 8 - 1) }; // the tail bit
+
+        struct alignas(std::hardware_destructive_interference_size) Node
+        {
+            [[nodiscard]] T* Value() noexcept
+            {
+                return std::launder(reinterpret_cast<T*>(Storage));
+            }
+
+            alignas(T) std::byte Storage[sizeof(T)];
+            std::atomic<std::size_t> Sequence;
+        };
+
+    public:
+        Segment() noexcept
+        {
+            for (std::size_t i{}; i < SegmentSize; ++i)
+            {
+                mNodes[i].Sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        ~Segment() noexcept
+        {
+            const auto tail{ mTail.load(std::memory_order_relaxed) & ~CLOSED };
+            for (auto position{ mHead.load(std::memory_order_relaxed) }; position != tail; ++position)
+            {
+                std::destroy_at(mNodes[position & MASK].Value());
+            }
+        }
+
+        // false -> the segment is closed, the value has to go to the next one
+        [[nodiscard]] bool TryPush(T& value) noexcept
+        {
+            auto position{ mTail.load(std::memory_order_relaxed) };
+
+            for (;;)
+            {
+                if ((position & CLOSED) != 0)
+                {
+                    return false;
+                }
+
+                auto& node{ mNodes[position & MASK] };
+                const auto difference{ static_cast<std::intptr_t>(node.Sequence.load(std::memory_order_acquire)) - static_cast<std::intptr_t>(position) };
+
+                if (difference == 0)
+                {
+                    if (mTail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        std::construct_at(node.Value(), std::move(value));
+                        node.Sequence.store(position + 1, std::memory_order_release);
+
+                        return true;
+                    }
+                }
+                else if (difference < 0) // full -> close it, a failed CAS reloads the position and we look again
+                {
+                    if (mTail.compare_exchange_weak(position, position | CLOSED, std::memory_order_relaxed))
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    position = mTail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        [[nodiscard]] bool TryPop(T& value) noexcept
+        {
+            auto position{ mHead.load(std::memory_order_relaxed) };
+
+            for (;;)
+            {
+                auto& node{ mNodes[position & MASK] };
+                const auto difference{ static_cast<std::intptr_t>(node.Sequence.load(std::memory_order_acquire)) - static_cast<std::intptr_t>(position + 1) };
+
+                if (difference == 0)
+                {
+                    if (mHead.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        auto* stored_value{ node.Value() };
+
+                        value = std::move(*stored_value);
+                        std::destroy_at(stored_value);
+
+                        node.Sequence.store(position + SegmentSize, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = mHead.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        [[nodiscard]] bool IsEmpty() const noexcept
+        {
+            return mHead.load(std::memory_order_acquire) == (mTail.load(std::memory_order_acquire) & ~CLOSED);
+        }
+
+        // Closed and every claimed slot was popped -> nothing will ever be read from or written to it again
+        [[nodiscard]] bool IsDrained() const noexcept
+        {
+            const auto tail{ mTail.load(std::memory_order_acquire) };
+            return (tail & CLOSED) != 0 && mHead.load(std::memory_order_acquire) == (tail & ~CLOSED);
+        }
+
+        // Only for a drained segment nobody refers to: head == tail and every slot sequence already matches
+        // the next lap, so reopening the tail is enough (no O(SegmentSize) reset)
+        void Reopen() noexcept
+        {
+            mTail.store(mTail.load(std::memory_order_relaxed) & ~CLOSED, std::memory_order_relaxed);
+            Next.store(nullptr, std::memory_order_relaxed);
+        }
+
+    public:
+        alignas(std::hardware_destructive_interference_size) std::atomic<Segment*> Next{ nullptr };
+        std::atomic<Segment*> FreeNext{ nullptr }; // link in the retired list / pool
+
+    private:
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> mHead{};
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> mTail{};
+
+        std::array<Node, SegmentSize> mNodes;
+    };
+
+public:
+    using value_type = T;
+
+public:
+    UnboundedLFQueue()
+    {
+        auto* segment{ NewSegment() };
+
+        mHeadSegment.store(segment, std::memory_order_relaxed);
+        mTailSegment.store(segment, std::memory_order_relaxed);
+    }
+
+    ~UnboundedLFQueue() noexcept
+    {
+        for (auto* segment{ mHeadSegment.load(std::memory_order_relaxed) }; segment != nullptr;)
+        {
+            delete std::exchange(segment, segment->Next.load(std::memory_order_relaxed));
+        }
+
+        for (auto* list : { mRetired.load(std::memory_order_relaxed), mPool.load(std::memory_order_relaxed) })
+        {
+            while (list != nullptr)
+            {
+                delete std::exchange(list, list->FreeNext.load(std::memory_order_relaxed));
+            }
+        }
+    }
+
+    UnboundedLFQueue(const UnboundedLFQueue& other) = delete;
+    UnboundedLFQueue& operator=(const UnboundedLFQueue& other) = delete;
+
+    // Always succeeds (the bool keeps the LFQueue interface), throws std::bad_alloc if a new segment can't be allocated
+    [[nodiscard]] bool TryPush(T& value)
+    {
+        typename hazard_domain_t::Guard guard{ mHazards };
+
+        for (;;)
+        {
+            auto* segment{ guard.Protect(SEGMENT_SLOT, mTailSegment) };
+            if (segment->TryPush(value))
+            {
+                return true;
+            }
+
+            // the segment is closed -> continue in the next one, link a new one if nobody did it yet
+            auto* next{ segment->Next.load(std::memory_order_acquire) };
+            if (next == nullptr)
+            {
+                auto* fresh{ AcquireSegment(guard) };
+
+                if (segment->Next.compare_exchange_strong(next, fresh, std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    next = fresh;
+                }
+                else
+                {
+                    Retire(fresh); // someone may still hold it as a stale pool top, so it goes through the hazard check too
+                }
+            }
+
+            mTailSegment.compare_exchange_strong(segment, next, std::memory_order_acq_rel, std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] bool TryPop(T& value)
+    {
+        typename hazard_domain_t::Guard guard{ mHazards };
+
+        for (;;)
+        {
+            auto* segment{ guard.Protect(SEGMENT_SLOT, mHeadSegment) };
+            if (segment->TryPop(value))
+            {
+                return true;
+            }
+
+            auto* next{ segment->Next.load(std::memory_order_acquire) };
+            if (!segment->IsDrained() || next == nullptr)
+            {
+                return false;
+            }
+
+            // the tail must never point to a retired segment, move it first if it lags behind
+            auto* expected{ segment };
+            mTailSegment.compare_exchange_strong(expected, next, std::memory_order_acq_rel, std::memory_order_relaxed);
+
+            expected = segment;
+            if (mHeadSegment.compare_exchange_strong(expected, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                guard.Clear(SEGMENT_SLOT);
+                Retire(segment);
+            }
+        }
+    }
+
+    // A drained head segment with a successor means the closing push has a value further on (or is about to)
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        typename hazard_domain_t::Guard guard{ mHazards };
+
+        auto* segment{ guard.Protect(SEGMENT_SLOT, mHeadSegment) };
+        return segment->IsEmpty() && segment->Next.load(std::memory_order_acquire) == nullptr;
+    }
+
+    // Segments allocated so far (in use + retired + pooled), stays constant once the bursts stop growing
+    [[nodiscard]] inline std::size_t AllocatedSegments() const noexcept
+    {
+        return mAllocatedSegments.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] constexpr std::size_t SegmentCapacity() const noexcept
+    {
+        return SegmentSize;
+    }
+
+private:
+    [[nodiscard]] Segment* NewSegment()
+    {
+        auto* segment{ new Segment{} };
+        mAllocatedSegments.fetch_add(1, std::memory_order_relaxed);
+
+        return segment;
+    }
+
+    [[nodiscard]] Segment* AcquireSegment(typename hazard_domain_t::Guard& guard)
+    {
+        if (auto* segment{ PopPool(guard) }; segment != nullptr)
+        {
+            return segment;
+        }
+
+        Reclaim();
+
+        if (auto* segment{ PopPool(guard) }; segment != nullptr)
+        {
+            return segment;
+        }
+
+        return NewSegment();
+    }
+
+    // Treiber stack pop, the hazard on the top keeps it from being popped, recycled and pushed back meanwhile (ABA)
+    [[nodiscard]] Segment* PopPool(typename hazard_domain_t::Guard& guard) noexcept
+    {
+        for (;;)
+        {
+            auto* top{ guard.Protect(POOL_SLOT, mPool) };
+            if (top == nullptr)
+            {
+                return nullptr;
+            }
+
+            if (mPool.compare_exchange_weak(top, top->FreeNext.load(std::memory_order_relaxed), std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                guard.Clear(POOL_SLOT);
+                return top;
+            }
+        }
+    }
+
+    static void PushList(std::atomic<Segment*>& list, Segment* segment) noexcept
+    {
+        auto* top{ list.load(std::memory_order_relaxed) };
+        do
+        {
+            segment->FreeNext.store(top, std::memory_order_relaxed);
+        } while (!list.compare_exchange_weak(top, segment, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void Retire(Segment* segment) noexcept
+    {
+        PushList(mRetired, segment);
+    }
+
+    // Moves every retired segment without a hazard to the pool, the rest goes back to the retired list
+    void Reclaim() noexcept
+    {
+        auto* retired{ mRetired.exchange(nullptr, std::memory_order_acquire) };
+        if (retired == nullptr)
+        {
+            return;
+        }
+
+        typename hazard_domain_t::hazards_t hazards;
+        const auto hazard_count{ mHazards.CollectHazards(hazards) };
+
+        while (retired != nullptr)
+        {
+            auto* segment{ std::exchange(retired, retired->FreeNext.load(std::memory_order_relaxed)) };
+
+            if (hazard_domain_t::IsHazard(hazards, hazard_count, segment))
+            {
+                Retire(segment);
+            }
+            else
+            {
+                segment->Reopen();
+                PushList(mPool, segment);
+            }
+        }
+    }
+
+private:
+    alignas(std::hardware_destructive_interference_size) std::atomic<Segment*> mHeadSegment{};
+    alignas(std::hardware_destructive_interference_size) std::atomic<Segment*> mTailSegment{};
+
+    alignas(std::hardware_destructive_interference_size) std::atomic<Segment*> mRetired{};
+    std::atomic<Segment*> mPool{};
+    std::atomic<std::size_t> mAllocatedSegments{};
+
+    mutable hazard_domain_t mHazards;
+};
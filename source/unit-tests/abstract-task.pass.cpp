@@ -23,6 +23,15 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <stdexcept>
+#include <vector>
+#include <type_traits>
+
 #include <abstract-task/abstract-task.hpp>
 
 int add(int a, int b)
@@ -38,7 +47,14 @@ TEST(AbstractTask, move_default_func)
         
         EXPECT_EQ(task_2(), 0);
         EXPECT_EQ(future_1.get(), 3);
+
+        // the moved-from task is empty
+        EXPECT_FALSE(task_1);
+        EXPECT_THROW(task_1(), std::bad_function_call);
     }
+
+    abstract_task::Task<std::int32_t()> empty_task{};
+    EXPECT_THROW(empty_task(), std::bad_function_call);
 }
 
 TEST(AbstractTask, move_lambda)
@@ -50,4 +66,254 @@ TEST(AbstractTask, move_lambda)
         EXPECT_EQ(task_2(), 0);
         EXPECT_EQ(future_1.get(), 6);
     }
-}
\ No newline at end of file
+}
+
+TEST(AbstractTask, inline_and_heap_storage)
+{
+    {
+        std::array<std::byte, abstract_task::DEFAULT_INLINE_SIZE * 2> big_capture{};
+        big_capture[0] = std::byte{ 7 };
+
+        abstract_task::Task<int()> small_task{ []() -> int { return 1; } };
+        abstract_task::Task<int()> big_task{ [big_capture]() -> int { return static_cast<int>(big_capture[0]); } };
+
+        auto moved_small_task{ std::move(small_task) };
+        auto moved_big_task{ std::move(big_task) };
+
+        EXPECT_FALSE(small_task);
+        EXPECT_FALSE(big_task);
+
+        EXPECT_EQ(moved_small_task(), 1);
+        EXPECT_EQ(moved_big_task(), 7);
+    }
+}
+
+TEST(AbstractTask, move_assignment_releases_callable)
+{
+    {
+        auto counter{ std::make_shared<int>(0) };
+
+        abstract_task::Task<int()> task_1{ [counter]() -> int { return *counter; } };
+        abstract_task::Task<int()> task_2{ []() -> int { return 2; } };
+
+        EXPECT_EQ(counter.use_count(), 2);
+
+        task_1 = std::move(task_2);
+
+        EXPECT_EQ(counter.use_count(), 1);
+        EXPECT_EQ(task_1(), 2);
+    }
+}
+
+TEST(AbstractTask, lightweight_future)
+{
+    {
+        auto&& [task, future]{ abstract_task::CreateTask(abstract_task::LIGHTWEIGHT, add, 1, 2) };
+
+        EXPECT_FALSE(future.IsReady());
+        EXPECT_EQ(task(), 0);
+        EXPECT_TRUE(future.IsReady());
+        EXPECT_EQ(future.Get(), 3);
+    }
+
+    {
+        auto&& [task, future]{ abstract_task::CreateTask(abstract_task::LIGHTWEIGHT, [](std::unique_ptr<int> value) -> std::unique_ptr<int> { return value; }, std::make_unique<int>(5)) };
+
+        std::thread consumer{ [&task]() -> void { EXPECT_EQ(task(), 0); } };
+        EXPECT_EQ(*future.Get(), 5);
+
+        consumer.join();
+    }
+}
+
+TEST(AbstractTask, promise_without_future)
+{
+    auto value{ std::make_shared<int>(1) };
+
+    {
+        abstract_task::Promise<std::shared_ptr<int>> promise{};
+        promise.SetValue(value);
+
+        EXPECT_EQ(value.use_count(), 2);
+    } // nobody took the future -> the promise frees the shared state (and the value in it)
+
+    EXPECT_EQ(value.use_count(), 1);
+
+    abstract_task::Promise<int> promise{};
+    auto future{ promise.GetFuture() };
+
+    EXPECT_THROW(static_cast<void>(promise.GetFuture()), std::future_error);
+
+    promise.SetValue(7);
+    EXPECT_EQ(future.Get(), 7);
+}
+
+TEST(AbstractTask, lightweight_future_exception)
+{
+    {
+        auto&& [task, future]{ abstract_task::CreateTask(abstract_task::LIGHTWEIGHT, []() -> void { throw std::runtime_error{ "error" }; }) };
+
+        EXPECT_EQ(task(), 0);
+        EXPECT_THROW(future.Get(), std::runtime_error);
+    }
+
+    {
+        abstract_task::Future<int> future{};
+        {
+            auto&& [task, task_future]{ abstract_task::CreateTask(abstract_task::LIGHTWEIGHT, add, 1, 2) };
+            future = std::move(task_future);
+        } // the task is destroyed without being run
+
+        EXPECT_THROW(future.Get(), std::future_error);
+    }
+}
+
+TEST(AbstractTask, detached_task)
+{
+    {
+        int result{};
+
+        auto task{ abstract_task::CreateTask(abstract_task::DETACHED, [&result](int a, int b) -> void { result = a + b; }, 1, 2) };
+        auto failing_task{ abstract_task::CreateTask(abstract_task::DETACHED, []() -> void { throw std::runtime_error{ "error" }; }) };
+
+        EXPECT_EQ(task(), 0);
+        EXPECT_EQ(result, 3);
+        EXPECT_EQ(failing_task(), -1);
+    }
+}
+
+struct CopyCounter
+{
+    CopyCounter() noexcept = default;
+    CopyCounter(const CopyCounter& other) noexcept : Copies{ other.Copies + 1 } { }
+    CopyCounter(CopyCounter&& other) noexcept = default;
+
+    int Copies{};
+};
+
+TEST(AbstractTask, bound_arguments_are_moved)
+{
+    {
+        auto&& [task, future]{ abstract_task::CreateTask([](std::unique_ptr<int> value, CopyCounter counter) -> int { return *value + counter.Copies; }, std::make_unique<int>(1), CopyCounter{}) };
+
+        EXPECT_EQ(task(), 0);
+        EXPECT_EQ(future.get(), 1);
+    }
+}
+
+struct WorkerContext
+{
+    int Id{};
+    std::vector<int> Scratch{};
+};
+
+TEST(AbstractTask, typed_tasks)
+{
+    {
+        auto&& [task, future]{ abstract_task::CreateTask<void()>(add, 1, 2) };
+
+        static_assert(std::is_same_v<decltype(task), abstract_task::Task<void()>>);
+
+        task();
+        EXPECT_EQ(future.get(), 3);
+    }
+
+    {
+        WorkerContext context{ 7 };
+
+        auto&& [task, future]{ abstract_task::CreateTask<void(WorkerContext&)>([](WorkerContext& context, int value) -> int 
+        { 
+            context.Scratch.push_back(value);
+            return context.Id + value; 
+        }, 3) };
+
+        task(context);
+
+        EXPECT_EQ(future.get(), 10);
+        EXPECT_EQ(std::size(context.Scratch), 1);
+    }
+
+    {
+        WorkerContext context{ 1 };
+
+        auto&& [task, future]{ abstract_task::CreateTask<std::int32_t(WorkerContext&)>(abstract_task::LIGHTWEIGHT, [](WorkerContext& context) -> int { return context.Id; }) };
+        auto detached_task{ abstract_task::CreateTask<std::int32_t(WorkerContext&)>(abstract_task::DETACHED, [](WorkerContext& context) -> void { ++context.Id; }) };
+
+        EXPECT_EQ(task(context), 0);
+        EXPECT_EQ(detached_task(context), 0);
+
+        EXPECT_EQ(future.Get(), 1);
+        EXPECT_EQ(context.Id, 2);
+    }
+}
+
+struct NamedCallable
+{
+    std::int32_t operator()() const { return 0; }
+};
+
+TEST(AbstractTask, type_name)
+{
+    abstract_task::Task<std::int32_t()> empty_task{};
+    abstract_task::Task<std::int32_t()> task{ NamedCallable{} };
+
+    EXPECT_TRUE(empty_task.TypeName().empty());
+    EXPECT_NE(task.TypeName().find("NamedCallable"), std::string_view::npos);
+    EXPECT_EQ(abstract_task::detail::TypeName<int>(), "int");
+}
+
+TEST(AbstractTask, package_task)
+{
+    auto&& [callable, future]{ abstract_task::PackageTask([](int value) -> int { return value * 2; }, 21) };
+
+    // fits inline and can't throw -> the task can be built where it is stored without a failure path
+    static_assert(std::is_nothrow_constructible_v<abstract_task::Task<std::int32_t()>, decltype(std::move(callable))>);
+
+    abstract_task::Task<std::int32_t()> task{ std::move(callable) };
+
+    EXPECT_EQ(task(), 0);
+    EXPECT_EQ(future.get(), 42);
+
+    // the tasks without TaskOptions don't pay for them: promise + function + one pointer still fits inline
+    std::vector<int> data{ 1, 2, 3 };
+    auto&& [pointer_callable, pointer_future]{ abstract_task::PackageTask([](std::vector<int>* values) -> std::size_t { return values->size(); }, &data) };
+
+    static_assert(sizeof(pointer_callable) <= abstract_task::DEFAULT_INLINE_SIZE);
+    static_assert(std::is_nothrow_constructible_v<abstract_task::Task<std::int32_t()>, decltype(std::move(pointer_callable))>);
+
+    abstract_task::Task<std::int32_t()> pointer_task{ std::move(pointer_callable) };
+
+    EXPECT_EQ(pointer_task(), 0);
+    EXPECT_EQ(pointer_future.get(), 3);
+}
+
+TEST(AbstractTask, cancelled_and_expired_tasks)
+{
+    std::atomic<int> calls{};
+    auto function{ [&calls](int value) -> int { calls.fetch_add(1); return value; } };
+
+    cancellation::CancellationSource source{};
+
+    auto&& [task, future]{ abstract_task::CreateTask(abstract_task::TaskOptions{ .Token = source.GetToken() }, function, 1) };
+    auto&& [lightweight_task, lightweight_future]{ abstract_task::CreateTask(abstract_task::LIGHTWEIGHT, abstract_task::TaskOptions{ .Token = source.GetToken() }, function, 2) };
+    auto detached_task{ abstract_task::CreateTask(abstract_task::DETACHED, abstract_task::TaskOptions{ .Token = source.GetToken() }, function, 3) };
+
+    auto&& [expired_task, expired_future]{ abstract_task::CreateTask(abstract_task::TaskOptions{ .Deadline = std::chrono::steady_clock::now() - std::chrono::milliseconds{ 1 } }, function, 4) };
+    auto&& [valid_task, valid_future]{ abstract_task::CreateTask(abstract_task::TaskOptions{ .Deadline = std::chrono::steady_clock::now() + std::chrono::hours{ 1 } }, function, 5) };
+
+    source.Cancel();
+
+    // skipped tasks still complete successfully, only their futures report the cancellation
+    EXPECT_EQ(task(), 0);
+    EXPECT_EQ(lightweight_task(), 0);
+    EXPECT_EQ(detached_task(), 0);
+    EXPECT_EQ(expired_task(), 0);
+    EXPECT_EQ(valid_task(), 0);
+
+    EXPECT_EQ(calls.load(), 1);
+
+    EXPECT_THROW(future.get(), abstract_task::TaskCancelled);
+    EXPECT_THROW(lightweight_future.Get(), abstract_task::TaskCancelled);
+    EXPECT_THROW(expired_future.get(), abstract_task::TaskCancelled);
+    EXPECT_EQ(valid_future.get(), 5);
+}
@@ -0,0 +1,238 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <coroutine>
+
+#include <async-queue/async-queue.hpp>
+#include <coroutine-scheduler/coroutine-scheduler.hpp>
+#include <lock-free-bounded-queue/lock-free-bounded-queue.hpp>
+
+using scheduler_t = executor::CoroutineScheduler<>;
+
+template <std::size_t Size>
+using async_queue_t = AsyncLFQueue<LFQueue<std::size_t, Size>, scheduler_t>;
+
+template <typename Counter>
+static void WaitFor(Counter& counter, std::size_t expected)
+{
+    for (auto count{ counter.load() }; count < expected; count = counter.load())
+    {
+        counter.wait(count);
+    }
+}
+
+static executor::DetachedCoroutine PopOne(scheduler_t& scheduler, async_queue_t<4>& queue, std::atomic<std::size_t>& result)
+{
+    co_await scheduler.Schedule();
+
+    result.store(co_await queue.Pop() + 1);
+    result.notify_all();
+}
+
+TEST(AsyncQueue, pop_suspends_until_push)
+{
+    std::atomic<std::size_t> result{};
+    scheduler_t scheduler{ 2 };
+    async_queue_t<4> queue{ scheduler };
+
+    PopOne(scheduler, queue, result);
+
+    std::size_t value{ 41 };
+    ASSERT_TRUE(queue.TryPush(value));
+
+    WaitFor(result, 1);
+    ASSERT_EQ(result.load(), 42);
+    ASSERT_TRUE(queue.IsEmpty());
+}
+
+static executor::DetachedCoroutine Producer(scheduler_t& scheduler, async_queue_t<16>& queue, std::atomic<std::size_t>& done, std::size_t count)
+{
+    co_await scheduler.Schedule();
+
+    for (std::size_t i{}; i < count; ++i)
+    {
+        co_await queue.Push(i);
+    }
+
+    done.fetch_add(1);
+    done.notify_all();
+}
+
+static executor::DetachedCoroutine Consumer(scheduler_t& scheduler, async_queue_t<16>& queue, std::atomic<std::size_t>& done, std::atomic<std::size_t>& sum, std::size_t count)
+{
+    co_await scheduler.Schedule();
+
+    std::size_t local_sum{};
+    for (std::size_t i{}; i < count; ++i)
+    {
+        local_sum += co_await queue.Pop();
+    }
+
+    sum.fetch_add(local_sum);
+
+    done.fetch_add(1);
+    done.notify_all();
+}
+
+// Thousands of coroutines on two threads wait on a queue of 16 values
+TEST(AsyncQueue, many_coroutines)
+{
+    constexpr std::size_t COROUTINE_COUNT{ 1'000 };
+    constexpr std::size_t ITEM_COUNT{ 100 };
+
+    std::atomic<std::size_t> done{};
+    std::atomic<std::size_t> sum{};
+
+    scheduler_t scheduler{ 2 };
+    auto queue{ std::make_unique<async_queue_t<16>>(scheduler) };
+
+    for (std::size_t i{}; i < COROUTINE_COUNT; ++i)
+    {
+        Consumer(scheduler, *queue, done, sum, ITEM_COUNT);
+        Producer(scheduler, *queue, done, ITEM_COUNT);
+    }
+
+    WaitFor(done, 2 * COROUTINE_COUNT);
+
+    ASSERT_EQ(sum.load(), COROUTINE_COUNT * (ITEM_COUNT * (ITEM_COUNT - 1) / 2));
+    ASSERT_TRUE(queue->IsEmpty());
+}
+
+// Resumes nothing by itself: the test decides when the served coroutines continue
+struct ManualScheduler
+{
+    void Resume(std::coroutine_handle<> handle)
+    {
+        Handles.push_back(handle);
+    }
+
+    void ResumeAll()
+    {
+        for (auto handle : std::exchange(Handles, {}))
+        {
+            handle.resume();
+        }
+    }
+
+    std::vector<std::coroutine_handle<>> Handles{};
+};
+
+using manual_queue_t = AsyncLFQueue<LFQueue<std::size_t, 4>, ManualScheduler>;
+
+static executor::DetachedCoroutine PushValue(manual_queue_t& queue, std::size_t value)
+{
+    co_await queue.Push(value);
+}
+
+static executor::DetachedCoroutine PopValue(manual_queue_t& queue, std::vector<std::size_t>& values)
+{
+    values.push_back(co_await queue.Pop());
+}
+
+TEST(AsyncQueue, waiters_are_served_in_fifo_order)
+{
+    ManualScheduler scheduler{};
+    manual_queue_t queue{ scheduler };
+
+    // pushers suspended on a full queue
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.TryPush(i));
+    }
+
+    for (std::size_t i{ 4 }; i < 8; ++i)
+    {
+        PushValue(queue, i);
+    }
+
+    for (std::size_t i{}; i < 8; ++i)
+    {
+        std::size_t value{};
+        ASSERT_TRUE(queue.TryPop(value));
+        ASSERT_EQ(value, i);
+    }
+
+    ASSERT_TRUE(queue.IsEmpty());
+    ASSERT_EQ(scheduler.Handles.size(), 4);
+    scheduler.ResumeAll();
+
+    // poppers suspended on an empty queue
+    std::vector<std::size_t> values{};
+    for (std::size_t i{}; i < 3; ++i)
+    {
+        PopValue(queue, values);
+    }
+
+    for (std::size_t i{}; i < 3; ++i)
+    {
+        ASSERT_TRUE(queue.TryPush(i));
+    }
+
+    scheduler.ResumeAll();
+    ASSERT_EQ(values, (std::vector<std::size_t>{ 0, 1, 2 }));
+}
+
+struct NoDefault
+{
+    explicit NoDefault(std::size_t value) noexcept : 
+        Value{ value }
+    { }
+
+    std::size_t Value;
+};
+
+using no_default_queue_t = AsyncLFQueue<LFQueue<NoDefault, 4>, ManualScheduler>;
+
+static executor::DetachedCoroutine PopNoDefault(no_default_queue_t& queue, std::vector<std::size_t>& values)
+{
+    values.push_back((co_await queue.Pop()).Value);
+}
+
+TEST(AsyncQueue, value_without_default_constructor)
+{
+    ManualScheduler scheduler{};
+    no_default_queue_t queue{ scheduler };
+    std::vector<std::size_t> values{};
+
+    // suspends, then served by the push
+    PopNoDefault(queue, values);
+
+    NoDefault value{ 1 };
+    ASSERT_TRUE(queue.TryPush(value));
+
+    scheduler.ResumeAll();
+
+    // ready right away
+    value = NoDefault{ 2 };
+    ASSERT_TRUE(queue.TryPush(value));
+
+    PopNoDefault(queue, values);
+
+    ASSERT_EQ(values, (std::vector<std::size_t>{ 1, 2 }));
+    ASSERT_TRUE(queue.IsEmpty());
+}
@@ -0,0 +1,114 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+#include <blocking-queue/blocking-queue.hpp>
+#include <lock-free-bounded-queue/lock-free-bounded-queue.hpp>
+
+constexpr static std::size_t ITEM_COUNT{ 100'000 };
+
+using BlockingQueue_ = BlockingLFQueue<LFQueue<std::size_t, 64>>;
+
+// Producers and consumers only use the blocking calls, a small queue makes both sides sleep
+TEST(BlockingQueue, push_pop_4c_4p)
+{
+    BlockingQueue_ queue{};
+    std::atomic<std::size_t> sum{};
+
+    std::vector<std::thread> consumers{};
+    std::vector<std::thread> producers{};
+
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        consumers.emplace_back([&queue, &sum]() -> void
+        {
+            std::size_t local_sum{};
+            for (std::size_t j{}; j < ITEM_COUNT / 4; ++j)
+            {
+                std::size_t value{};
+                queue.Pop(value);
+
+                local_sum += value;
+            }
+
+            sum.fetch_add(local_sum);
+        });
+
+        producers.emplace_back([&queue, i]() -> void
+        {
+            for (std::size_t j{ i }; j < ITEM_COUNT; j += 4)
+            {
+                auto value{ j };
+                queue.Push(value);
+            }
+        });
+    }
+
+    for (auto&& p : producers)
+    {
+        p.join();
+    }
+
+    for (auto&& c : consumers)
+    {
+        c.join();
+    }
+
+    ASSERT_TRUE(queue.IsEmpty());
+    ASSERT_EQ(sum.load(), ITEM_COUNT * (ITEM_COUNT - 1) / 2);
+}
+
+TEST(BlockingQueue, pop_for_times_out)
+{
+    BlockingQueue_ queue{};
+
+    std::size_t value{};
+    const auto start{ std::chrono::steady_clock::now() };
+
+    ASSERT_FALSE(queue.PopFor(value, std::chrono::milliseconds{ 20 }));
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds{ 20 });
+}
+
+TEST(BlockingQueue, pop_until_wakes_up)
+{
+    BlockingQueue_ queue{};
+
+    std::thread producer{ [&queue]() -> void
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+
+        std::size_t value{ 42 };
+        queue.Push(value);
+    } };
+
+    std::size_t value{};
+    ASSERT_TRUE(queue.PopUntil(value, std::chrono::steady_clock::now() + std::chrono::seconds{ 10 }));
+    ASSERT_EQ(value, 42);
+
+    producer.join();
+}
@@ -0,0 +1,75 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <cancellation/cancellation.hpp>
+
+TEST(Cancellation, source_and_tokens)
+{
+    cancellation::CancellationToken default_token{};
+    EXPECT_FALSE(default_token.IsCancelled());
+
+    cancellation::CancellationToken token{};
+    {
+        cancellation::CancellationSource source{};
+
+        token = source.GetToken();
+        auto copied_token{ token };
+
+        EXPECT_FALSE(source.IsCancelled());
+        EXPECT_FALSE(copied_token.IsCancelled());
+
+        source.Cancel();
+
+        EXPECT_TRUE(source.IsCancelled());
+        EXPECT_TRUE(copied_token.IsCancelled());
+
+        // one-shot: a token taken after Cancel() is cancelled as well
+        EXPECT_TRUE(source.GetToken().IsCancelled());
+    }
+
+    // the token keeps the state alive
+    EXPECT_TRUE(token.IsCancelled());
+}
+
+TEST(Cancellation, registry_groups)
+{
+    cancellation::CancellationRegistry registry{};
+
+    auto first_token{ registry.Token(1) };
+    auto other_group_token{ registry.Token(2) };
+
+    registry.Cancel(1);
+    registry.Cancel(3); // unknown groups are ignored
+
+    EXPECT_TRUE(first_token.IsCancelled());
+    EXPECT_FALSE(other_group_token.IsCancelled());
+
+    // the next batch of the group is valid again
+    auto second_token{ registry.Token(1) };
+    EXPECT_FALSE(second_token.IsCancelled());
+
+    registry.Remove(2);
+    EXPECT_FALSE(other_group_token.IsCancelled());
+    EXPECT_FALSE(registry.Token(2).IsCancelled());
+}
@@ -0,0 +1,86 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include <coroutine-scheduler/coroutine-scheduler.hpp>
+
+using scheduler_t = executor::CoroutineScheduler<>;
+
+template <typename Scheduler>
+static executor::DetachedCoroutine Hop(Scheduler& scheduler, std::atomic<std::size_t>& done, std::size_t hops)
+{
+    const auto caller_id{ std::this_thread::get_id() };
+    co_await scheduler.Schedule();
+
+    if (std::this_thread::get_id() == caller_id)
+    {
+        std::terminate(); // must run on a worker now
+    }
+
+    for (std::size_t i{}; i < hops; ++i)
+    {
+        co_await scheduler.Schedule();
+    }
+
+    done.fetch_add(1);
+    done.notify_all();
+}
+
+TEST(CoroutineScheduler, schedule)
+{
+    constexpr std::size_t COROUTINE_COUNT{ 10'000 };
+
+    std::atomic<std::size_t> done{};
+    scheduler_t scheduler{ 4 };
+
+    ASSERT_EQ(scheduler.ThreadCount(), 4);
+
+    for (std::size_t i{}; i < COROUTINE_COUNT; ++i)
+    {
+        Hop(scheduler, done, 10);
+    }
+
+    for (auto count{ done.load() }; count < COROUTINE_COUNT; count = done.load())
+    {
+        done.wait(count);
+    }
+}
+
+// More coroutines than the run queue holds: the workers resume inline instead of waiting for space
+TEST(CoroutineScheduler, run_queue_overflow)
+{
+    std::atomic<std::size_t> done{};
+
+    {
+        executor::CoroutineScheduler<16> scheduler{ 2 };
+        for (std::size_t i{}; i < 1'000; ++i)
+        {
+            Hop(scheduler, done, 3);
+        }
+    } // the destructor resumes everything queued
+
+    ASSERT_EQ(done.load(), 1'000);
+}
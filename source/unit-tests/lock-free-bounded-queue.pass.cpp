@@ -27,13 +27,17 @@
 #include <mutex>
 #include <ranges>
 #include <format>
+#include <array>
+#include <span>
+#include <memory>
+#include <system_error>
 
 #include <lock-free-bounded-queue/lock-free-bounded-queue.hpp>
 
 constexpr static std::size_t TASK_COUNT{ 100'000 };
 constexpr static std::size_t QUEUE_SIZE{ 1 << 10 };
 
-using LFQueue_ = LFQueue<QUEUE_SIZE>;
+using LFQueue_ = LFTaskQueue<QUEUE_SIZE>;
 using TaskFutureBuffer_ = std::vector<std::future<std::size_t>>;
 
 void print_result_buffer(const std::vector<std::size_t>& result_buffer)
@@ -44,11 +48,12 @@ void print_result_buffer(const std::vector<std::size_t>& result_buffer)
     }
 }
 
-void consume(LFQueue_& queue, std::atomic<bool>& is_done)
+template <typename Queue = LFQueue_>
+void consume(Queue& queue, std::atomic<bool>& is_done)
 {
     while (!is_done.load(std::memory_order_acquire) || !queue.IsEmpty())
     {
-        LFQueue_::abstract_task_t task{};
+        typename Queue::value_type task{};
         if (queue.TryPop(task))
         {
             auto result{ task() };
@@ -65,7 +70,8 @@ void consume(LFQueue_& queue, std::atomic<bool>& is_done)
     }
 }
 
-void produce(LFQueue_& queue, TaskFutureBuffer_& task_future_buffer, std::mutex& mutex, const std::size_t task_count)
+template <typename Queue = LFQueue_>
+void produce(Queue& queue, TaskFutureBuffer_& task_future_buffer, std::mutex& mutex, const std::size_t task_count)
 {
     TaskFutureBuffer_ local_task_future_buffer{};
     local_task_future_buffer.reserve(task_count);
@@ -104,8 +110,8 @@ TEST(LockFreeBoundedQueue, test_1c_1p)
     std::atomic<bool> is_done{ false };
     std::mutex mutex{};
 
-    std::thread consumer{ consume, std::ref(queue), std::ref(is_done) };
-    std::thread producer{ produce, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT };
+    std::thread consumer{ consume<>, std::ref(queue), std::ref(is_done) };
+    std::thread producer{ produce<>, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT };
 
     producer.join();
     is_done.store(true, std::memory_order_release);
@@ -143,8 +149,8 @@ TEST(LockFreeBoundedQueue, test_2c_2p)
 
     for (std::size_t i{}; i < 2; ++i)
     {
-        consumers.emplace_back(consume, std::ref(queue), std::ref(is_done));
-        producers.emplace_back(produce, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT / 2);
+        consumers.emplace_back(consume<>, std::ref(queue), std::ref(is_done));
+        producers.emplace_back(produce<>, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT / 2);
     }
 
     for (auto&& p : producers)
@@ -191,8 +197,8 @@ TEST(LockFreeBoundedQueue, test_4c_4p)
 
     for (std::size_t i{}; i < 4; ++i)
     {
-        consumers.emplace_back(consume, std::ref(queue), std::ref(is_done));
-        producers.emplace_back(produce, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT / 4);
+        consumers.emplace_back(consume<>, std::ref(queue), std::ref(is_done));
+        producers.emplace_back(produce<>, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT / 4);
     }
 
     for (auto&& p : producers)
@@ -239,8 +245,8 @@ TEST(LockFreeBoundedQueue, test_8c_8p)
 
     for (std::size_t i{}; i < 8; ++i)
     {
-        consumers.emplace_back(consume, std::ref(queue), std::ref(is_done));
-        producers.emplace_back(produce, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT / 8);
+        consumers.emplace_back(consume<>, std::ref(queue), std::ref(is_done));
+        producers.emplace_back(produce<>, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT / 8);
     }
 
     for (auto&& p : producers)
@@ -287,8 +293,8 @@ TEST(LockFreeBoundedQueue, test_10c_10p)
 
     for (std::size_t i{}; i < 10; ++i)
     {
-        consumers.emplace_back(consume, std::ref(queue), std::ref(is_done));
-        producers.emplace_back(produce, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT / 10);
+        consumers.emplace_back(consume<>, std::ref(queue), std::ref(is_done));
+        producers.emplace_back(produce<>, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT / 10);
     }
 
     for (auto&& p : producers)
@@ -335,8 +341,8 @@ TEST(LockFreeBoundedQueue, test_16c_16p)
 
     for (std::size_t i{}; i < 16; ++i)
     {
-        consumers.emplace_back(consume, std::ref(queue), std::ref(is_done));
-        producers.emplace_back(produce, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT / 16);
+        consumers.emplace_back(consume<>, std::ref(queue), std::ref(is_done));
+        producers.emplace_back(produce<>, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT / 16);
     }
 
     for (auto&& p : producers)
@@ -362,4 +368,549 @@ TEST(LockFreeBoundedQueue, test_16c_16p)
 
     ASSERT_EQ(std::size(task_future_buffer), TASK_COUNT);
     ASSERT_EQ(std::size(result_buffer), TASK_COUNT);
-}
\ No newline at end of file
+}
+
+constexpr static std::size_t BULK_SIZE{ 32 };
+
+void consume_bulk(LFQueue_& queue, std::atomic<bool>& is_done)
+{
+    std::array<LFQueue_::value_type, BULK_SIZE> tasks{};
+
+    while (!is_done.load(std::memory_order_acquire) || !queue.IsEmpty())
+    {
+        auto count{ queue.TryPopBulk(tasks) };
+        for (std::size_t i{}; i < count; ++i)
+        {
+            if (tasks[i]() != 0)
+            {
+                std::cerr << "result != 0\n";
+                return;
+            }
+        }
+
+        if (count == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void produce_bulk(LFQueue_& queue, TaskFutureBuffer_& task_future_buffer, std::mutex& mutex, const std::size_t task_count)
+{
+    TaskFutureBuffer_ local_task_future_buffer{};
+    local_task_future_buffer.reserve(task_count);
+
+    std::vector<LFQueue_::value_type> tasks{};
+    tasks.reserve(BULK_SIZE);
+
+    for (std::size_t i{}; i < task_count; i += BULK_SIZE)
+    {
+        tasks.clear();
+        for (std::size_t j{ i }; j < std::min(i + BULK_SIZE, task_count); ++j)
+        {
+            auto&& [task, future] { abstract_task::CreateTask([](std::size_t a) -> std::size_t { return a; }, j) };
+
+            tasks.push_back(std::move(task));
+            local_task_future_buffer.push_back(std::move(future));
+        }
+
+        std::span<LFQueue_::value_type> pending{ tasks };
+        while (!std::empty(pending))
+        {
+            pending = pending.subspan(queue.TryPushBulk(pending));
+            std::this_thread::yield();
+        }
+    }
+
+    std::lock_guard<std::mutex> lk{ mutex };
+    std::ranges::move(local_task_future_buffer, std::back_inserter(task_future_buffer));
+}
+
+// test_bulk_partial -> bulk operations move only as many tasks as there are free/filled slots
+TEST(LockFreeBoundedQueue, test_bulk_partial)
+{
+    LFTaskQueue<4> queue{};
+
+    std::vector<LFTaskQueue<4>::value_type> tasks{};
+    std::vector<std::future<std::size_t>> futures{};
+
+    for (std::size_t i{}; i < 6; ++i)
+    {
+        auto&& [task, future] { abstract_task::CreateTask([](std::size_t a) -> std::size_t { return a; }, i) };
+
+        tasks.push_back(std::move(task));
+        futures.push_back(std::move(future));
+    }
+
+    ASSERT_EQ(queue.TryPushBulk(tasks), 4);
+    ASSERT_EQ(queue.TryPushBulk(std::span{ tasks }.subspan(4)), 0);
+
+    std::array<LFTaskQueue<4>::value_type, 3> popped{};
+    ASSERT_EQ(queue.TryPopBulk(popped), 3);
+    ASSERT_EQ(queue.TryPushBulk(std::span{ tasks }.subspan(4)), 2);
+
+    for (auto&& task : popped)
+    {
+        EXPECT_EQ(task(), 0);
+    }
+
+    ASSERT_EQ(queue.TryPopBulk(popped), 3);
+    ASSERT_TRUE(queue.IsEmpty());
+
+    for (auto&& task : popped)
+    {
+        EXPECT_EQ(task(), 0);
+    }
+
+    for (std::size_t i{}; i < 6; ++i)
+    {
+        EXPECT_EQ(futures[i].get(), i);
+    }
+}
+
+// test_bulk_4c_4p -> 4 bulk producer -> 4 bulk consumer
+TEST(LockFreeBoundedQueue, test_bulk_4c_4p)
+{
+    LFQueue_ queue{};
+    
+    TaskFutureBuffer_ task_future_buffer{};
+    task_future_buffer.reserve(TASK_COUNT);
+
+    std::atomic<bool> is_done{ false };
+    std::mutex mutex{};
+
+    std::vector<std::thread> consumers{};
+    std::vector<std::thread> producers{};
+
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        consumers.emplace_back(consume_bulk, std::ref(queue), std::ref(is_done));
+        producers.emplace_back(produce_bulk, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT / 4);
+    }
+
+    for (auto&& p : producers)
+    {
+        p.join();
+    }
+
+    is_done.store(true, std::memory_order_release);
+
+    for (auto&& c : consumers)
+    {
+        c.join();
+    }
+
+    std::size_t sum{};
+    for (auto&& f : task_future_buffer)
+    {
+        sum += f.get();
+    }
+
+    ASSERT_EQ(std::size(task_future_buffer), TASK_COUNT);
+    ASSERT_EQ(sum, 4 * ((TASK_COUNT / 4) * (TASK_COUNT / 4 - 1) / 2));
+}
+
+template <typename Queue>
+void run_specialized_queue(const std::size_t producer_count, const std::size_t consumer_count)
+{
+    Queue queue{};
+
+    TaskFutureBuffer_ task_future_buffer{};
+    task_future_buffer.reserve(TASK_COUNT);
+
+    std::atomic<bool> is_done{ false };
+    std::mutex mutex{};
+
+    std::vector<std::thread> consumers{};
+    std::vector<std::thread> producers{};
+
+    for (std::size_t i{}; i < consumer_count; ++i)
+    {
+        consumers.emplace_back(consume<Queue>, std::ref(queue), std::ref(is_done));
+    }
+
+    for (std::size_t i{}; i < producer_count; ++i)
+    {
+        producers.emplace_back(produce<Queue>, std::ref(queue), std::ref(task_future_buffer), std::ref(mutex), TASK_COUNT / producer_count);
+    }
+
+    for (auto&& p : producers)
+    {
+        p.join();
+    }
+
+    is_done.store(true, std::memory_order_release);
+
+    for (auto&& c : consumers)
+    {
+        c.join();
+    }
+
+    std::size_t result_count{};
+    for (auto&& f : task_future_buffer)
+    {
+        f.get();
+        ++result_count;
+    }
+
+    ASSERT_EQ(std::size(task_future_buffer), TASK_COUNT);
+    ASSERT_EQ(result_count, TASK_COUNT);
+}
+
+// test_spsc -> 1 producer -> 1 consumer without CAS on either end
+TEST(LockFreeBoundedQueue, test_spsc)
+{
+    run_specialized_queue<LFTaskQueue<QUEUE_SIZE, concurrency::SPSC>>(1, 1);
+}
+
+// test_mpsc -> 4 producer -> 1 consumer
+TEST(LockFreeBoundedQueue, test_mpsc)
+{
+    run_specialized_queue<LFTaskQueue<QUEUE_SIZE, concurrency::MPSC>>(4, 1);
+}
+
+// test_spmc -> 1 producer -> 4 consumer
+TEST(LockFreeBoundedQueue, test_spmc)
+{
+    run_specialized_queue<LFTaskQueue<QUEUE_SIZE, concurrency::SPMC>>(1, 4);
+}
+
+struct LiveCounter
+{
+    explicit LiveCounter(std::atomic<std::int32_t>& counter) noexcept : Counter{ &counter } { Counter->fetch_add(1); }
+    LiveCounter(LiveCounter&& other) noexcept : Counter{ other.Counter } { Counter->fetch_add(1); }
+    LiveCounter& operator=(LiveCounter&& other) noexcept = default;
+    ~LiveCounter() noexcept { Counter->fetch_sub(1); }
+
+    std::atomic<std::int32_t>* Counter;
+};
+
+// test_plain_values -> the queue holds trivially copyable values directly
+TEST(LockFreeBoundedQueue, test_plain_values)
+{
+    SPSCQueue<std::uint64_t, 8> queue{};
+
+    for (std::uint64_t i{}; i < 8; ++i)
+    {
+        ASSERT_TRUE(queue.TryPush(i));
+    }
+
+    std::uint64_t value{ 8 };
+    ASSERT_FALSE(queue.TryPush(value));
+
+    for (std::uint64_t i{}; i < 8; ++i)
+    {
+        ASSERT_TRUE(queue.TryPop(value));
+        ASSERT_EQ(value, i);
+    }
+
+    ASSERT_FALSE(queue.TryPop(value));
+}
+
+// test_lazy_slots -> values are constructed on push and destroyed on pop or with the queue
+TEST(LockFreeBoundedQueue, test_lazy_slots)
+{
+    std::atomic<std::int32_t> alive{};
+
+    {
+        LFQueue<LiveCounter, 8> queue{};
+        ASSERT_EQ(alive.load(), 0);
+
+        for (std::size_t i{}; i < 4; ++i)
+        {
+            LiveCounter value{ alive };
+            ASSERT_TRUE(queue.TryPush(value));
+        }
+
+        ASSERT_EQ(alive.load(), 4);
+
+        LiveCounter value{ alive };
+        ASSERT_TRUE(queue.TryPop(value));
+        ASSERT_EQ(alive.load(), 4);
+    }
+
+    ASSERT_EQ(alive.load(), 0);
+}
+
+// test_heap_queue -> the capacity is rounded up to a power of two and the buffer lives on the heap
+TEST(LockFreeBoundedQueue, test_heap_queue)
+{
+    LFHeapQueue<std::uint64_t> queue{ 1'000 };
+    ASSERT_EQ(queue.Capacity(), 1'024);
+
+    for (std::uint64_t i{}; i < 1'024; ++i)
+    {
+        ASSERT_TRUE(queue.TryPush(i));
+    }
+
+    std::uint64_t value{};
+    ASSERT_FALSE(queue.TryPush(value));
+
+    for (std::uint64_t i{}; i < 1'024; ++i)
+    {
+        ASSERT_TRUE(queue.TryPop(value));
+        ASSERT_EQ(value, i);
+    }
+}
+
+#if defined(__linux__)
+// test_huge_page_queue -> a heap queue over 2 MB pages bound to the first NUMA node
+TEST(LockFreeBoundedQueue, test_huge_page_queue)
+{
+    using HugePageQueue_ = LFHeapQueue<LFQueue_::value_type, concurrency::MPMC, memory::HugePageAllocator>;
+
+    HugePageQueue_ queue{ 1 << 16, memory::HugePageAllocator{ 0 } };
+    ASSERT_EQ(queue.Capacity(), 1 << 16);
+
+    TaskFutureBuffer_ task_future_buffer{};
+    std::mutex mutex{};
+
+    produce(queue, task_future_buffer, mutex, 1 << 16);
+
+    std::atomic<bool> is_done{ true };
+    consume(queue, is_done);
+
+    ASSERT_TRUE(queue.IsEmpty());
+    for (std::size_t i{}; i < std::size(task_future_buffer); ++i)
+    {
+        ASSERT_EQ(task_future_buffer[i].get(), 3 * i + 6);
+    }
+
+    // a node which doesn't exist (beyond the 64 nodes of one mask word) is reported instead of silently ignored
+    ASSERT_THROW(std::ignore = memory::HugePageAllocator{ 1'000 }.Allocate(1 << 16, 64), std::system_error);
+}
+#endif
+
+// test_packed_layout -> the remapped packed layout keeps FIFO order and works under contention
+TEST(LockFreeBoundedQueue, test_packed_layout)
+{
+    {
+        LFPackedQueue<std::uint64_t, 16> queue{};
+
+        for (std::uint64_t round{}; round < 3; ++round)
+        {
+            for (std::uint64_t i{}; i < 16; ++i)
+            {
+                ASSERT_TRUE(queue.TryPush(i));
+            }
+
+            std::uint64_t value{};
+            ASSERT_FALSE(queue.TryPush(value));
+
+            for (std::uint64_t i{}; i < 16; ++i)
+            {
+                ASSERT_TRUE(queue.TryPop(value));
+                ASSERT_EQ(value, i);
+            }
+        }
+    }
+
+    run_specialized_queue<LFTaskQueue<QUEUE_SIZE, concurrency::MPMC, layout::Packed>>(4, 4);
+}
+
+TEST(LockFreeBoundedQueue, test_approx_size)
+{
+    LFQueue<std::size_t, 8> queue{};
+    ASSERT_EQ(queue.ApproxSize(), 0);
+
+    for (std::size_t i{}; i < 8; ++i)
+    {
+        ASSERT_TRUE(queue.TryPush(i));
+        ASSERT_EQ(queue.ApproxSize(), i + 1);
+    }
+
+    std::size_t value{};
+    ASSERT_FALSE(queue.TryPush(value));
+    ASSERT_EQ(queue.ApproxSize(), 8);
+
+    ASSERT_TRUE(queue.TryPop(value));
+    ASSERT_EQ(queue.ApproxSize(), 7);
+}
+
+struct MoveCounter
+{
+    inline static std::size_t Moves{};
+
+    explicit MoveCounter(std::size_t value) noexcept : Value{ value } { }
+    MoveCounter(MoveCounter&& other) noexcept : Value{ other.Value } { ++Moves; }
+    MoveCounter& operator=(MoveCounter&& other) noexcept { Value = other.Value; ++Moves; return *this; }
+
+    std::size_t Value;
+};
+
+template <typename Queue>
+void run_claim_handles()
+{
+    Queue queue{};
+    MoveCounter::Moves = 0;
+
+    for (std::size_t round{}; round < 3; ++round)
+    {
+        for (std::size_t i{}; i < 8; ++i)
+        {
+            auto handle{ queue.TryClaimWrite() };
+            ASSERT_TRUE(handle);
+
+            handle.Emplace(i);
+            handle.Commit();
+        }
+
+        ASSERT_FALSE(queue.TryClaimWrite());
+
+        for (std::size_t i{}; i < 8; ++i)
+        {
+            auto handle{ queue.TryClaimRead() };
+            ASSERT_TRUE(handle);
+            ASSERT_EQ(handle->Value, i);
+        } // released by the destructor
+
+        ASSERT_FALSE(queue.TryClaimRead());
+    }
+
+    // constructed and used in place
+    ASSERT_EQ(MoveCounter::Moves, 0);
+}
+
+TEST(LockFreeBoundedQueue, test_claim_handles)
+{
+    run_claim_handles<LFQueue<MoveCounter, 8>>();
+    run_claim_handles<SPSCQueue<MoveCounter, 8>>();
+    run_claim_handles<LFPackedQueue<MoveCounter, 8>>();
+
+    // mixed with the moving API
+    LFQueue<std::size_t, 4> queue{};
+
+    auto write_handle{ queue.TryClaimWrite() };
+    write_handle.Emplace(42);
+    write_handle.Commit();
+
+    std::size_t value{};
+    ASSERT_TRUE(queue.TryPop(value));
+    ASSERT_EQ(value, 42);
+
+    value = 7;
+    ASSERT_TRUE(queue.TryPush(value));
+
+    auto read_handle{ queue.TryClaimRead() };
+    ASSERT_EQ(*read_handle, 7);
+
+    read_handle.Release();
+    ASSERT_TRUE(queue.IsEmpty());
+}
+
+// Two handles of the same side outstanding at once, finished in and out of claim order
+template <typename Queue>
+void run_outstanding_claim_handles()
+{
+    Queue queue{};
+    auto value{ std::make_shared<std::size_t>() };
+
+    for (std::size_t round{}; round < 3; ++round)
+    {
+        auto first_write{ queue.TryClaimWrite() };
+        auto second_write{ queue.TryClaimWrite() };
+        ASSERT_TRUE(first_write && second_write);
+
+        first_write.Emplace(value);
+        second_write.Emplace(value);
+
+        if (round % 2 == 0)
+        {
+            first_write.Commit();
+            second_write.Commit();
+        }
+        else
+        {
+            second_write.Commit();
+            ASSERT_FALSE(queue.TryClaimRead()); // the first slot isn't published yet
+            first_write.Commit();
+        }
+
+        ASSERT_EQ(queue.ApproxSize(), 2);
+        ASSERT_EQ(value.use_count(), 3);
+
+        {
+            auto first_read{ queue.TryClaimRead() };
+            auto second_read{ queue.TryClaimRead() };
+            ASSERT_TRUE(first_read && second_read);
+            ASSERT_FALSE(queue.TryClaimRead());
+
+            ASSERT_NE(&*first_read, &*second_read);
+        } // released in reverse claim order by the destructors
+
+        ASSERT_EQ(value.use_count(), 1);
+        ASSERT_EQ(queue.ApproxSize(), 0);
+        ASSERT_TRUE(queue.IsEmpty());
+    }
+}
+
+TEST(LockFreeBoundedQueue, test_outstanding_claim_handles)
+{
+    run_outstanding_claim_handles<SPSCQueue<std::shared_ptr<std::size_t>, 4>>();
+    run_outstanding_claim_handles<LFQueue<std::shared_ptr<std::size_t>, 4>>();
+}
+
+TEST(LockFreeBoundedQueue, test_uncommitted_write_handle_terminates)
+{
+    auto claim_and_drop = []() -> void
+    {
+        LFQueue<std::size_t, 4> queue{};
+        auto handle{ queue.TryClaimWrite() };
+    };
+
+    ASSERT_DEATH(claim_and_drop(), "");
+}
+
+TEST(LockFreeBoundedQueue, test_try_emplace)
+{
+    {
+        LFQueue<MoveCounter, 4> queue{};
+        MoveCounter::Moves = 0;
+
+        for (std::size_t i{}; i < 4; ++i)
+        {
+            ASSERT_TRUE(queue.TryEmplace(i));
+        }
+
+        ASSERT_FALSE(queue.TryEmplace(std::size_t{ 4 }));
+
+        auto handle{ queue.TryClaimRead() };
+        ASSERT_EQ(handle->Value, 0);
+        ASSERT_EQ(MoveCounter::Moves, 0);
+    }
+
+    {
+        LFTaskQueue<4> queue{};
+        std::vector<std::future<int>> futures{};
+
+        for (int i{}; i < 4; ++i)
+        {
+            auto&& [callable, future]{ abstract_task::PackageTask([](int value) -> int { return value; }, i) };
+            ASSERT_TRUE(queue.TryEmplace(std::move(callable)));
+
+            futures.push_back(std::move(future));
+        }
+
+        // a full queue leaves the callable untouched, it can be passed again
+        auto&& [callable, future]{ abstract_task::PackageTask([]() -> int { return 4; }) };
+        ASSERT_FALSE(queue.TryEmplace(std::move(callable)));
+
+        LFTaskQueue<4>::value_type task{};
+        ASSERT_TRUE(queue.TryPop(task));
+        ASSERT_EQ(task(), 0);
+
+        ASSERT_TRUE(queue.TryEmplace(std::move(callable)));
+
+        while (queue.TryPop(task))
+        {
+            ASSERT_EQ(task(), 0);
+        }
+
+        for (int i{}; i < 4; ++i)
+        {
+            ASSERT_EQ(futures[static_cast<std::size_t>(i)].get(), i);
+        }
+
+        ASSERT_EQ(future.get(), 4);
+    }
+}
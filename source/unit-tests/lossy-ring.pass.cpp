@@ -0,0 +1,193 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+
+#include <lossy-ring/lossy-ring.hpp>
+
+struct TraceEvent
+{
+    std::uint32_t Producer;
+    std::uint64_t Sequence;
+    std::array<std::uint8_t, 20> Payload;
+};
+
+TEST(LossyRing, read_in_order)
+{
+    LossyRing<std::uint64_t, 16> ring{};
+    auto reader{ ring.MakeReader() };
+
+    std::uint64_t value{};
+    ASSERT_FALSE(reader.TryRead(value));
+
+    for (std::uint64_t i{}; i < 10; ++i)
+    {
+        ring.Push(i);
+    }
+
+    for (std::uint64_t i{}; i < 10; ++i)
+    {
+        ASSERT_TRUE(reader.TryRead(value));
+        ASSERT_EQ(value, i);
+    }
+
+    ASSERT_FALSE(reader.TryRead(value));
+    ASSERT_EQ(reader.Lost(), 0);
+}
+
+TEST(LossyRing, lapped_reader_resyncs)
+{
+    LossyRing<std::uint64_t, 16> ring{};
+    auto reader{ ring.MakeReader() };
+
+    // the producer never waits for the reader, the first two laps are overwritten
+    for (std::uint64_t i{}; i < 3 * 16; ++i)
+    {
+        ring.Push(i);
+    }
+
+    std::uint64_t value{};
+    for (std::uint64_t i{ 2 * 16 }; i < 3 * 16; ++i)
+    {
+        ASSERT_TRUE(reader.TryRead(value));
+        ASSERT_EQ(value, i);
+    }
+
+    ASSERT_FALSE(reader.TryRead(value));
+    ASSERT_EQ(reader.Lost(), 2 * 16);
+    ASSERT_EQ(ring.Dropped(), 0);
+}
+
+TEST(LossyRing, broadcast)
+{
+    LossyRing<std::uint64_t, 16> ring{};
+
+    auto first_reader{ ring.MakeReader() };
+    auto second_reader{ ring.MakeReader() };
+
+    for (std::uint64_t i{}; i < 8; ++i)
+    {
+        ring.Push(i);
+    }
+
+    for (auto* reader : { &first_reader, &second_reader })
+    {
+        for (std::uint64_t i{}; i < 8; ++i)
+        {
+            std::uint64_t value{};
+            ASSERT_TRUE(reader->TryRead(value));
+            ASSERT_EQ(value, i);
+        }
+    }
+}
+
+TEST(LossyRing, producers_readers_2p_2r)
+{
+    constexpr std::uint64_t EVENT_COUNT{ 100'000 };
+
+    LossyRing<TraceEvent, 256> ring{};
+    std::atomic<std::size_t> ready_readers{};
+    std::atomic<bool> is_done{ false };
+
+    std::vector<std::thread> readers{};
+    std::vector<std::thread> producers{};
+
+    for (std::size_t i{}; i < 2; ++i)
+    {
+        readers.emplace_back([&ring, &ready_readers, &is_done]() -> void
+        {
+            auto reader{ ring.MakeReader() };
+            ready_readers.fetch_add(1);
+
+            std::array<std::uint64_t, 2> next_sequence{};
+            std::uint64_t read_count{};
+
+            for (;;)
+            {
+                const auto is_last_pass{ is_done.load() };
+
+                TraceEvent event{};
+                if (!reader.TryRead(event))
+                {
+                    if (is_last_pass)
+                    {
+                        break;
+                    }
+
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                // per producer order is kept and the payload is never torn
+                ASSERT_GE(event.Sequence, next_sequence[event.Producer]);
+                ASSERT_EQ(event.Payload[0], static_cast<std::uint8_t>(event.Sequence));
+                ASSERT_EQ(event.Payload[19], static_cast<std::uint8_t>(event.Sequence));
+
+                next_sequence[event.Producer] = event.Sequence + 1;
+                ++read_count;
+            }
+
+            // every position is either read or counted as lost, a dropped one at the very end may still be pending
+            ASSERT_LE(read_count + reader.Lost(), 2 * EVENT_COUNT);
+            ASSERT_GT(read_count, 0);
+        });
+    }
+
+    while (ready_readers.load() < 2)
+    {
+        std::this_thread::yield();
+    }
+
+    for (std::uint32_t i{}; i < 2; ++i)
+    {
+        producers.emplace_back([&ring, i]() -> void
+        {
+            for (std::uint64_t j{}; j < EVENT_COUNT; ++j)
+            {
+                TraceEvent event{ i, j, {} };
+                event.Payload.fill(static_cast<std::uint8_t>(j));
+
+                ring.Push(event);
+            }
+        });
+    }
+
+    for (auto& thread : producers)
+    {
+        thread.join();
+    }
+
+    is_done.store(true);
+
+    for (auto& thread : readers)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(ring.Position(), 2 * EVENT_COUNT);
+}
@@ -0,0 +1,160 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <thread>
+#include <vector>
+#include <future>
+#include <cstdint>
+
+#include <pool-allocator/pool-allocator.hpp>
+#include <abstract-task/abstract-task.hpp>
+#include <lock-free-bounded-queue/lock-free-bounded-queue.hpp>
+
+TEST(PoolAllocator, size_classes_and_reuse)
+{
+    memory::PoolAllocator allocator{};
+
+    auto* small{ allocator.Allocate(24, 8) };
+    auto* aligned{ allocator.Allocate(8, 64) };
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(small) % 8, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 64, 0);
+
+    // the last freed block of a class is handed out first
+    allocator.Deallocate(small, 24, 8);
+    EXPECT_EQ(allocator.Allocate(32, 8), small);
+
+    allocator.Deallocate(small, 32, 8);
+    allocator.Deallocate(aligned, 8, 64);
+
+    // bigger blocks go to operator new
+    auto* big{ allocator.Allocate(memory::PoolAllocator::MAX_BLOCK_SIZE + 1, 8) };
+    allocator.Deallocate(big, memory::PoolAllocator::MAX_BLOCK_SIZE + 1, 8);
+}
+
+// Blocks allocated by the producer and freed by the consumer go back to the producer: the steady state maps no new chunks
+TEST(PoolAllocator, remote_free)
+{
+    constexpr std::size_t ROUND_COUNT{ 100 };
+    constexpr std::size_t BLOCK_COUNT{ 1'000 };
+
+    memory::PoolAllocator allocator{};
+    LFQueue<void*, 1'024> queue{};
+
+    std::size_t chunk_count{};
+
+    for (std::size_t round{}; round < ROUND_COUNT; ++round)
+    {
+        std::thread consumer{ [&queue, &allocator]() -> void
+        {
+            for (std::size_t i{}; i < BLOCK_COUNT; ++i)
+            {
+                void* block{};
+                while (!queue.TryPop(block))
+                {
+                    std::this_thread::yield();
+                }
+
+                allocator.Deallocate(block, 128, 8);
+            }
+        } };
+
+        for (std::size_t i{}; i < BLOCK_COUNT; ++i)
+        {
+            void* block{ allocator.Allocate(128, 8) };
+            while (!queue.TryPush(block))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        consumer.join();
+
+        if (round == 0)
+        {
+            chunk_count = memory::PoolAllocator::ChunkCount();
+        }
+    }
+
+    EXPECT_EQ(memory::PoolAllocator::ChunkCount(), chunk_count);
+}
+
+// The heap of an exited thread is adopted by the next one together with everything freed into it
+TEST(PoolAllocator, orphan_adoption)
+{
+    memory::PoolAllocator allocator{};
+    std::vector<void*> blocks(500);
+
+    auto allocate_all{ [&allocator, &blocks]() -> void
+    {
+        for (auto&& block : blocks)
+        {
+            block = allocator.Allocate(1'024, 8);
+        }
+    } };
+
+    std::thread{ allocate_all }.join();
+    for (auto* block : blocks)
+    {
+        allocator.Deallocate(block, 1'024, 8);
+    }
+
+    const auto chunk_count{ memory::PoolAllocator::ChunkCount() };
+    for (std::size_t i{}; i < 10; ++i)
+    {
+        std::thread{ allocate_all }.join();
+        for (auto* block : blocks)
+        {
+            allocator.Deallocate(block, 1'024, 8);
+        }
+    }
+
+    EXPECT_EQ(memory::PoolAllocator::ChunkCount(), chunk_count);
+}
+
+// Task callables which don't fit inline and the CreateTask results come from the pool
+TEST(PoolAllocator, task_storage)
+{
+    std::array<std::byte, abstract_task::DEFAULT_INLINE_SIZE * 2> big_capture{};
+    big_capture[0] = std::byte{ 3 };
+
+    auto run{ [&big_capture]() -> void
+    {
+        auto&& [task, future]{ abstract_task::CreateTask([big_capture](int value) -> int { return static_cast<int>(big_capture[0]) + value; }, 4) };
+
+        EXPECT_EQ(task(), 0);
+        EXPECT_EQ(future.get(), 7);
+    } };
+
+    run();
+
+    const auto chunk_count{ memory::PoolAllocator::ChunkCount() };
+    for (std::size_t i{}; i < 10'000; ++i)
+    {
+        run();
+    }
+
+    EXPECT_EQ(memory::PoolAllocator::ChunkCount(), chunk_count);
+}
@@ -0,0 +1,166 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <memory>
+
+#include <priority-queue/priority-queue.hpp>
+
+TEST(PriorityQueue, strict_priority)
+{
+    PriorityLFQueue<std::size_t, 16, 3> queue{};
+
+    for (std::size_t i{}; i < 12; ++i)
+    {
+        std::size_t value{ i };
+        ASSERT_TRUE(queue.TryPush(value, 2 - i % 3));
+    }
+
+    ASSERT_EQ(queue.ApproxSize(), 12);
+
+    // lane 0 holds 2, 5, 8, 11 -> it is drained first, FIFO inside a lane
+    std::vector<std::size_t> expected{ 2, 5, 8, 11, 1, 4, 7, 10, 0, 3, 6, 9 };
+    for (auto expected_value : expected)
+    {
+        std::size_t value{};
+        ASSERT_TRUE(queue.TryPop(value));
+        ASSERT_EQ(value, expected_value);
+    }
+
+    std::size_t value{};
+    ASSERT_FALSE(queue.TryPop(value));
+    ASSERT_TRUE(queue.IsEmpty());
+}
+
+TEST(PriorityQueue, weighted_round_robin)
+{
+    PriorityLFQueue<std::size_t, 64, 2> queue{ { 3, 1 } };
+
+    for (std::size_t i{}; i < 32; ++i)
+    {
+        std::size_t value{ 0 };
+        ASSERT_TRUE(queue.TryPush(value, 0));
+
+        value = 1;
+        ASSERT_TRUE(queue.TryPush(value, 1));
+    }
+
+    decltype(queue)::WeightedCursor cursor{};
+    std::array<std::size_t, 2> popped{};
+
+    for (std::size_t i{}; i < 40; ++i)
+    {
+        std::size_t value{};
+        ASSERT_TRUE(queue.TryPop(value, cursor));
+
+        // a fresh cursor starts with the full turn of the highest priority lane
+        ASSERT_EQ(value, i % 4 < 3 ? 0 : 1);
+        ++popped[value];
+    }
+
+    // 3:1 while both lanes are non-empty
+    ASSERT_EQ(popped[0], 30);
+    ASSERT_EQ(popped[1], 10);
+
+    // an empty lane doesn't stop the rotation
+    for (std::size_t i{}; i < 24; ++i)
+    {
+        std::size_t value{};
+        ASSERT_TRUE(queue.TryPop(value, cursor));
+        ASSERT_LT(value, 2);
+    }
+
+    std::size_t value{};
+    ASSERT_FALSE(queue.TryPop(value, cursor));
+}
+
+TEST(PriorityQueue, push_pop_4c_4p)
+{
+    constexpr std::size_t ITEM_COUNT{ 100'000 };
+    constexpr std::size_t LANE_COUNT{ 4 };
+
+    auto queue{ std::make_unique<PriorityLFQueue<std::size_t, 256, LANE_COUNT>>() };
+
+    std::atomic<std::size_t> popped_count{};
+    std::atomic<std::size_t> sum{};
+
+    std::vector<std::thread> consumers{};
+    std::vector<std::thread> producers{};
+
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        consumers.emplace_back([&queue, &popped_count, &sum, i]() -> void
+        {
+            decltype(queue)::element_type::WeightedCursor cursor{};
+            std::size_t local_sum{};
+
+            while (popped_count.load(std::memory_order_relaxed) < 4 * ITEM_COUNT)
+            {
+                std::size_t value{};
+                if (i % 2 == 0 ? queue->TryPop(value) : queue->TryPop(value, cursor))
+                {
+                    local_sum += value;
+                    popped_count.fetch_add(1, std::memory_order_relaxed);
+
+                    continue;
+                }
+
+                std::this_thread::yield();
+            }
+
+            sum.fetch_add(local_sum);
+        });
+    }
+
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        producers.emplace_back([&queue]() -> void
+        {
+            for (std::size_t j{}; j < ITEM_COUNT; ++j)
+            {
+                std::size_t value{ j };
+                while (!queue->TryPush(value, j % LANE_COUNT))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : producers)
+    {
+        thread.join();
+    }
+
+    for (auto& thread : consumers)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(sum.load(), 4 * (ITEM_COUNT * (ITEM_COUNT - 1) / 2));
+    ASSERT_TRUE(queue->IsEmpty());
+}
@@ -0,0 +1,128 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <thread>
+#include <chrono>
+
+#include <queue-stats/queue-stats.hpp>
+#include <lock-free-bounded-queue/lock-free-bounded-queue.hpp>
+
+TEST(QueueStats, no_stats_is_free)
+{
+    static_assert(sizeof(LFQueue<std::size_t, 64>) == sizeof(LFQueue<std::size_t, 64, concurrency::MPMC, memory::DefaultBufferAllocator, layout::Padded, queue_stats::NoStats>));
+    static_assert(sizeof(LFPackedQueue<std::size_t, 64>) < sizeof(LFQueue<std::size_t, 64, concurrency::MPMC, memory::DefaultBufferAllocator, layout::Packed, queue_stats::QueueStats>));
+}
+
+TEST(QueueStats, histogram_buckets)
+{
+    using queue_stats::LogHistogram;
+
+    for (std::uint64_t value : { 0ULL, 1ULL, 7ULL, 8ULL, 9ULL, 15ULL, 16ULL, 17ULL, 1'000ULL, 123'456'789ULL, ~0ULL })
+    {
+        const auto index{ LogHistogram::BucketIndex(value) };
+
+        ASSERT_LT(index, LogHistogram::BUCKET_COUNT);
+        ASSERT_LE(value, LogHistogram::BucketUpperBound(index));
+
+        if (index > 0)
+        {
+            ASSERT_GT(value, LogHistogram::BucketUpperBound(index - 1));
+        }
+    }
+
+    ASSERT_EQ(LogHistogram::BucketUpperBound(LogHistogram::BUCKET_COUNT - 1), ~0ULL);
+}
+
+TEST(QueueStats, counters)
+{
+    LFStatsQueue<std::size_t, 4, concurrency::SPSC> queue{};
+
+    std::size_t value{};
+    ASSERT_FALSE(queue.TryPop(value));
+
+    for (std::size_t i{}; i < 5; ++i)
+    {
+        value = i;
+        std::ignore = queue.TryPush(value);
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    std::vector<std::size_t> values(3);
+    ASSERT_EQ(queue.TryPopBulk(values), 3);
+
+    const auto snapshot{ queue.GetStats().TakeSnapshot() };
+
+    ASSERT_EQ(snapshot.Pushes, 4);
+    ASSERT_EQ(snapshot.Pops, 3);
+    ASSERT_EQ(snapshot.FailedFull, 1);
+    ASSERT_EQ(snapshot.FailedEmpty, 1);
+    ASSERT_EQ(snapshot.CasRetries, 0);
+
+    // every value waited at least 1ms
+    ASSERT_GE(snapshot.SojournPercentile(0.0), 1'000'000);
+    ASSERT_GE(snapshot.SojournPercentile(0.999), snapshot.SojournPercentile(0.5));
+}
+
+TEST(QueueStats, concurrent_snapshot)
+{
+    constexpr std::size_t ITEM_COUNT{ 100'000 };
+
+    LFStatsQueue<std::size_t, 1024> queue{};
+    std::vector<std::thread> threads{};
+
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        threads.emplace_back([&queue]() -> void
+        {
+            for (std::size_t j{}; j < ITEM_COUNT; ++j)
+            {
+                std::size_t value{ j };
+                while (!queue.TryPush(value)) { }
+                while (!queue.TryPop(value)) { }
+            }
+        });
+    }
+
+    // snapshots are taken while the queue is running
+    std::uint64_t last_pops{};
+    for (std::size_t i{}; i < 100; ++i)
+    {
+        const auto snapshot{ queue.GetStats().TakeSnapshot() };
+
+        ASSERT_GE(snapshot.Pops, last_pops);
+        last_pops = snapshot.Pops;
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto snapshot{ queue.GetStats().TakeSnapshot() };
+
+    ASSERT_EQ(snapshot.Pushes, 4 * ITEM_COUNT);
+    ASSERT_EQ(snapshot.Pops, 4 * ITEM_COUNT);
+}
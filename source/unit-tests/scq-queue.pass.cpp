@@ -0,0 +1,158 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <scq-queue/scq-queue.hpp>
+
+TEST(SCQueue, fifo_full_empty)
+{
+    SCQueue<std::string, 8> queue{};
+    ASSERT_EQ(queue.Capacity(), 8);
+    ASSERT_TRUE(queue.IsEmpty());
+
+    // several laps, so the ring positions go through a few cycles
+    for (std::size_t lap{}; lap < 10; ++lap)
+    {
+        for (std::size_t i{}; i < 8; ++i)
+        {
+            std::string value{ std::to_string(lap * 8 + i) };
+            ASSERT_TRUE(queue.TryPush(value));
+        }
+
+        std::string value{ "overflow" };
+        ASSERT_FALSE(queue.TryPush(value));
+        ASSERT_EQ(value, "overflow");
+
+        for (std::size_t i{}; i < 8; ++i)
+        {
+            ASSERT_TRUE(queue.TryPop(value));
+            ASSERT_EQ(value, std::to_string(lap * 8 + i));
+        }
+
+        ASSERT_FALSE(queue.TryPop(value));
+        ASSERT_TRUE(queue.IsEmpty());
+    }
+}
+
+TEST(SCQueue, destroys_remaining_values)
+{
+    auto counter{ std::make_shared<int>() };
+    {
+        SCQueue<std::shared_ptr<int>, 4> queue{};
+        for (std::size_t i{}; i < 3; ++i)
+        {
+            auto value{ counter };
+            ASSERT_TRUE(queue.TryPush(value));
+        }
+
+        ASSERT_EQ(counter.use_count(), 4);
+    }
+
+    ASSERT_EQ(counter.use_count(), 1);
+}
+
+TEST(SCQueue, push_pop_4c_4p)
+{
+    constexpr std::size_t ITEM_COUNT{ 100'000 };
+    constexpr std::size_t PRODUCER_SHIFT{ 32 };
+
+    auto queue{ std::make_unique<SCQueue<std::size_t, 64>>() };
+
+    std::atomic<std::size_t> popped_count{};
+    std::atomic<std::size_t> sum{};
+    std::atomic<bool> is_ordered{ true };
+
+    std::vector<std::thread> consumers{};
+    std::vector<std::thread> producers{};
+
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        consumers.emplace_back([&queue, &popped_count, &sum, &is_ordered]() -> void
+        {
+            // values of one producer must come out in the order they were pushed
+            std::array<std::size_t, 4> last_seen{};
+            std::size_t local_sum{};
+
+            while (popped_count.load(std::memory_order_relaxed) < 4 * ITEM_COUNT)
+            {
+                std::size_t value{};
+                if (queue->TryPop(value))
+                {
+                    const auto producer{ value >> PRODUCER_SHIFT };
+                    const auto sequence{ value & ((std::size_t{ 1 } << PRODUCER_SHIFT) - 1) };
+
+                    if (sequence + 1 <= last_seen[producer])
+                    {
+                        is_ordered.store(false, std::memory_order_relaxed);
+                    }
+
+                    last_seen[producer] = sequence + 1;
+                    local_sum += sequence;
+                    popped_count.fetch_add(1, std::memory_order_relaxed);
+
+                    continue;
+                }
+
+                std::this_thread::yield();
+            }
+
+            sum.fetch_add(local_sum);
+        });
+    }
+
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        producers.emplace_back([&queue, i]() -> void
+        {
+            for (std::size_t j{}; j < ITEM_COUNT; ++j)
+            {
+                std::size_t value{ (i << PRODUCER_SHIFT) | j };
+                while (!queue->TryPush(value))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : producers)
+    {
+        thread.join();
+    }
+
+    for (auto& thread : consumers)
+    {
+        thread.join();
+    }
+
+    ASSERT_TRUE(is_ordered.load());
+    ASSERT_EQ(sum.load(), 4 * (ITEM_COUNT * (ITEM_COUNT - 1) / 2));
+    ASSERT_TRUE(queue->IsEmpty());
+}
@@ -0,0 +1,127 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <memory>
+
+#include <sharded-queue/sharded-queue.hpp>
+
+TEST(ShardedQueue, home_shard_and_stealing)
+{
+    ShardedLFQueue<std::size_t, 4, 4> queue{};
+    ASSERT_EQ(queue.Capacity(), 16);
+
+    // the home shard is filled first, then the pushes spill over into the others
+    for (std::size_t i{}; i < 16; ++i)
+    {
+        std::size_t value{ i };
+        ASSERT_TRUE(queue.TryPush(value, 1));
+    }
+
+    std::size_t value{};
+    ASSERT_FALSE(queue.TryPush(value, 1));
+    ASSERT_EQ(queue.ApproxSize(), 16);
+
+    // FIFO inside a shard: shard 1 holds 0..3
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.TryPop(value, 1));
+        ASSERT_EQ(value, i);
+    }
+
+    // the rest is stolen from the other shards
+    for (std::size_t i{}; i < 12; ++i)
+    {
+        ASSERT_TRUE(queue.TryPop(value, 1));
+    }
+
+    ASSERT_FALSE(queue.TryPop(value, 1));
+    ASSERT_TRUE(queue.IsEmpty());
+}
+
+TEST(ShardedQueue, push_pop_4c_4p)
+{
+    constexpr std::size_t ITEM_COUNT{ 100'000 };
+
+    auto queue{ std::make_unique<ShardedLFQueue<std::size_t, 256, 4>>() };
+
+    std::atomic<std::size_t> popped_count{};
+    std::atomic<std::size_t> sum{};
+
+    std::vector<std::thread> consumers{};
+    std::vector<std::thread> producers{};
+
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        consumers.emplace_back([&queue, &popped_count, &sum]() -> void
+        {
+            std::size_t local_sum{};
+            while (popped_count.load(std::memory_order_relaxed) < 4 * ITEM_COUNT)
+            {
+                std::size_t value{};
+                if (queue->TryPop(value))
+                {
+                    local_sum += value;
+                    popped_count.fetch_add(1, std::memory_order_relaxed);
+
+                    continue;
+                }
+
+                std::this_thread::yield();
+            }
+
+            sum.fetch_add(local_sum);
+        });
+    }
+
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        producers.emplace_back([&queue]() -> void
+        {
+            for (std::size_t j{}; j < ITEM_COUNT; ++j)
+            {
+                std::size_t value{ j };
+                while (!queue->TryPush(value))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : producers)
+    {
+        thread.join();
+    }
+
+    for (auto& thread : consumers)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(sum.load(), 4 * (ITEM_COUNT * (ITEM_COUNT - 1) / 2));
+    ASSERT_TRUE(queue->IsEmpty());
+}
@@ -0,0 +1,151 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__)
+
+#include <string>
+#include <cstdint>
+#include <system_error>
+
+#include <sched.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include <shm-queue/shm-queue.hpp>
+
+struct Message
+{
+    std::uint64_t Id;
+    double Value;
+};
+
+static std::string UniqueName(const char* test_name)
+{
+    return "/lfq-test-" + std::string{ test_name } + "-" + std::to_string(::getpid());
+}
+
+TEST(ShmQueue, create_open)
+{
+    const auto name{ UniqueName("create-open") };
+
+    auto producer{ ShmLFQueue<Message>::Create(name, 64) };
+    auto consumer{ ShmLFQueue<Message>::Open(name) }; // a second mapping of the same region at another address
+
+    ShmLFQueue<Message>::Remove(name);
+
+    ASSERT_EQ(consumer.Capacity(), 64);
+    ASSERT_TRUE(consumer.IsEmpty());
+
+    for (std::uint64_t i{}; i < 64; ++i)
+    {
+        ASSERT_TRUE(producer.TryPush(Message{ i, static_cast<double>(i) / 2 }));
+    }
+
+    ASSERT_FALSE(producer.TryPush(Message{}));
+
+    for (std::uint64_t i{}; i < 64; ++i)
+    {
+        Message message{};
+        ASSERT_TRUE(consumer.TryPop(message));
+
+        ASSERT_EQ(message.Id, i);
+        ASSERT_EQ(message.Value, static_cast<double>(i) / 2);
+    }
+
+    ASSERT_TRUE(producer.IsEmpty());
+}
+
+TEST(ShmQueue, errors)
+{
+    const auto name{ UniqueName("errors") };
+
+    ASSERT_THROW(std::ignore = ShmLFQueue<Message>::Open(name), std::system_error);
+    ASSERT_THROW(std::ignore = ShmLFQueue<Message>::Create(name, 100), std::system_error);
+
+    auto queue{ ShmLFQueue<Message>::Create(name, 16) };
+
+    ASSERT_THROW(std::ignore = ShmLFQueue<Message>::Create(name, 16), std::system_error);
+    ASSERT_THROW(std::ignore = ShmLFQueue<std::uint32_t>::Open(name), std::system_error); // another value type
+
+    // a corrupted mask (the header starts with Magic, 4 x uint32_t, Capacity, Mask)
+    const auto descriptor{ ::shm_open(name.c_str(), O_RDWR, 0) };
+    ASSERT_NE(descriptor, -1);
+
+    const std::uint64_t mask{ 1'023 };
+    ASSERT_EQ(::pwrite(descriptor, &mask, sizeof(mask), 32), static_cast<ssize_t>(sizeof(mask)));
+    ::close(descriptor);
+
+    ASSERT_THROW(std::ignore = ShmLFQueue<Message>::Open(name), std::system_error);
+
+    ShmLFQueue<Message>::Remove(name);
+}
+
+TEST(ShmQueue, two_processes)
+{
+    constexpr std::uint64_t MESSAGE_COUNT{ 100'000 };
+
+    const auto name{ UniqueName("two-processes") };
+    auto queue{ ShmLFQueue<Message>::Create(name, 1'024) };
+
+    const auto child{ ::fork() };
+    ASSERT_NE(child, -1);
+
+    if (child == 0)
+    {
+        auto producer{ ShmLFQueue<Message>::Open(name) };
+        for (std::uint64_t i{}; i < MESSAGE_COUNT; ++i)
+        {
+            while (!producer.TryPush(Message{ i, 0.0 }))
+            {
+                ::sched_yield();
+            }
+        }
+
+        ::_exit(0);
+    }
+
+    std::uint64_t expected_id{};
+    while (expected_id < MESSAGE_COUNT)
+    {
+        Message message{};
+        if (!queue.TryPop(message))
+        {
+            ::sched_yield();
+            continue;
+        }
+
+        ASSERT_EQ(message.Id, expected_id++);
+    }
+
+    int status{};
+    ::waitpid(child, &status, 0);
+
+    ShmLFQueue<Message>::Remove(name);
+
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+#endif
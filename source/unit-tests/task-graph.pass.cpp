@@ -0,0 +1,126 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <stdexcept>
+
+#include <task-graph/task-graph.hpp>
+#include <thread-pool/thread-pool.hpp>
+
+// a -> { b, c } -> d, every run checks that a node starts only after its predecessors
+TEST(TaskGraph, diamond_rerun)
+{
+    executor::ThreadPool<> pool{ 4 };
+    executor::TaskGraph graph{};
+
+    std::array<std::atomic<std::size_t>, 4> runs{};
+    std::atomic<bool> is_ordered{ true };
+
+    auto check{ [&runs, &is_ordered](std::size_t node, std::size_t predecessor) -> void
+    {
+        if (runs[predecessor].load() <= runs[node].load())
+        {
+            is_ordered.store(false);
+        }
+    } };
+
+    const auto a{ graph.Emplace([&runs]() -> void { runs[0].fetch_add(1); }) };
+    const auto b{ graph.Emplace([&runs, &check]() -> void { check(1, 0); runs[1].fetch_add(1); }) };
+    const auto c{ graph.Emplace([&runs, &check]() -> void { check(2, 0); runs[2].fetch_add(1); }) };
+    const auto d{ graph.Emplace([&runs, &check]() -> void { check(3, 1); check(3, 2); runs[3].fetch_add(1); }) };
+
+    graph.Precede(a, b);
+    graph.Precede(a, c);
+    graph.Precede(b, d);
+    graph.Precede(c, d);
+
+    ASSERT_EQ(graph.NodeCount(), 4);
+
+    constexpr std::size_t RUN_COUNT{ 1'000 };
+    for (std::size_t i{}; i < RUN_COUNT; ++i)
+    {
+        graph.Run(pool);
+        graph.Wait();
+
+        ASSERT_EQ(runs[3].load(), i + 1);
+    }
+
+    ASSERT_TRUE(is_ordered.load());
+    for (auto&& count : runs)
+    {
+        ASSERT_EQ(count.load(), RUN_COUNT);
+    }
+}
+
+// Wide fan-out / fan-in: the join node runs once, after all the others
+TEST(TaskGraph, fan_out_fan_in)
+{
+    constexpr std::size_t WIDTH{ 1'000 };
+
+    executor::ThreadPool<64, 256> pool{ 4 };
+    executor::TaskGraph graph{};
+
+    std::atomic<std::size_t> executed{};
+    std::size_t executed_before_join{};
+
+    const auto source{ graph.Emplace([]() -> void {}) };
+    const auto join{ graph.Emplace([&executed, &executed_before_join]() -> void { executed_before_join = executed.load(); }) };
+
+    for (std::size_t i{}; i < WIDTH; ++i)
+    {
+        const auto node{ graph.Emplace([&executed]() -> void { executed.fetch_add(1); }) };
+
+        graph.Precede(source, node);
+        graph.Precede(node, join);
+    }
+
+    graph.Run(pool);
+    graph.Wait();
+
+    ASSERT_EQ(executed_before_join, WIDTH);
+}
+
+TEST(TaskGraph, exception_completes_run)
+{
+    executor::ThreadPool<> pool{ 2 };
+    executor::TaskGraph graph{};
+
+    std::atomic<std::size_t> executed{};
+
+    const auto failing{ graph.Emplace([]() -> void { throw std::runtime_error{ "node" }; }) };
+    const auto successor{ graph.Emplace([&executed]() -> void { executed.fetch_add(1); }) };
+    graph.Precede(failing, successor);
+
+    graph.Run(pool);
+    ASSERT_THROW(graph.Wait(), std::runtime_error);
+    ASSERT_EQ(executed.load(), 1);
+
+    // the exception is reported once, an empty graph completes right away
+    ASSERT_NO_THROW(graph.Wait());
+
+    executor::TaskGraph empty_graph{};
+    empty_graph.Run(pool);
+    empty_graph.Wait();
+}
@@ -0,0 +1,138 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <future>
+#include <atomic>
+#include <stdexcept>
+
+#include <thread-pool/thread-pool.hpp>
+
+constexpr static std::size_t TASK_COUNT{ 100'000 };
+
+TEST(ThreadPool, submit_from_outside)
+{
+    executor::ThreadPool<> pool{ 4 };
+
+    std::vector<std::future<std::size_t>> futures{};
+    futures.reserve(TASK_COUNT);
+
+    for (std::size_t i{}; i < TASK_COUNT; ++i)
+    {
+        futures.push_back(pool.Submit([](std::size_t a, std::size_t b) -> std::size_t { return a + b; }, i, 1));
+    }
+
+    for (std::size_t i{}; i < TASK_COUNT; ++i)
+    {
+        ASSERT_EQ(futures[i].get(), i + 1);
+    }
+}
+
+// Tasks spawned by the workers go to their local queues and get stolen by the idle ones
+TEST(ThreadPool, submit_from_workers)
+{
+    std::atomic<std::size_t> executed{};
+
+    {
+        executor::ThreadPool<64, 256> pool{ 4 };
+
+        std::vector<std::future<void>> futures{};
+        for (std::size_t i{}; i < 16; ++i)
+        {
+            futures.push_back(pool.Submit([&pool, &executed]() -> void
+            {
+                for (std::size_t j{}; j < 1'000; ++j)
+                {
+                    [[maybe_unused]] auto future{ pool.Submit([&executed]() -> void { executed.fetch_add(1); }) };
+                }
+            }));
+        }
+
+        for (auto&& f : futures)
+        {
+            f.get();
+        }
+    } // the destructor waits for everything spawned meanwhile
+
+    ASSERT_EQ(executed.load(), 16'000);
+}
+
+TEST(ThreadPool, shutdown_drains_queues)
+{
+    std::atomic<std::size_t> executed{};
+
+    executor::ThreadPool<> pool{ 2 };
+    for (std::size_t i{}; i < 1'000; ++i)
+    {
+        [[maybe_unused]] auto future{ pool.Submit([&executed]() -> void { executed.fetch_add(1); }) };
+    }
+
+    pool.Shutdown();
+    ASSERT_EQ(executed.load(), 1'000);
+}
+
+TEST(ThreadPool, post)
+{
+    std::atomic<std::size_t> executed{};
+
+    {
+        executor::ThreadPool<> pool{ 4 };
+        for (std::size_t i{}; i < TASK_COUNT; ++i)
+        {
+            pool.Post([&executed](std::size_t value) -> void { executed.fetch_add(value); }, 1);
+        }
+
+        // a throwing task must not take its worker down
+        pool.Post([]() -> void { throw std::runtime_error{ "post" }; });
+    }
+
+    ASSERT_EQ(executed.load(), TASK_COUNT);
+}
+
+// Bulk cancellation: the tasks of a cancelled group are skipped by the workers
+TEST(ThreadPool, submit_cancelled_group)
+{
+    std::atomic<std::size_t> executed{};
+    cancellation::CancellationRegistry registry{};
+
+    executor::ThreadPool<> pool{ 2 };
+
+    abstract_task::TaskOptions options{ .Token = registry.Token(7) };
+    registry.Cancel(7);
+
+    std::vector<std::future<void>> futures{};
+    for (std::size_t i{}; i < 1'000; ++i)
+    {
+        futures.push_back(pool.Submit(options, [&executed]() -> void { executed.fetch_add(1); }));
+        pool.Post(options, [&executed]() -> void { executed.fetch_add(1); });
+    }
+
+    for (auto&& future : futures)
+    {
+        ASSERT_THROW(future.get(), abstract_task::TaskCancelled);
+    }
+
+    pool.Shutdown();
+    ASSERT_EQ(executed.load(), 0);
+}
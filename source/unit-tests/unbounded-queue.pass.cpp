@@ -0,0 +1,166 @@
+// MIT License
+// 
+// Copyright (c) 2025 @Who
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <memory>
+
+#include <unbounded-queue/unbounded-queue.hpp>
+
+TEST(UnboundedQueue, grows_and_keeps_order)
+{
+    UnboundedLFQueue<std::size_t, 16> queue{};
+
+    for (std::size_t i{}; i < 16 * 10; ++i)
+    {
+        std::size_t value{ i };
+        ASSERT_TRUE(queue.TryPush(value));
+    }
+
+    ASSERT_GE(queue.AllocatedSegments(), 10);
+    ASSERT_FALSE(queue.IsEmpty());
+
+    for (std::size_t i{}; i < 16 * 10; ++i)
+    {
+        std::size_t value{};
+        ASSERT_TRUE(queue.TryPop(value));
+        ASSERT_EQ(value, i);
+    }
+
+    std::size_t value{};
+    ASSERT_FALSE(queue.TryPop(value));
+    ASSERT_TRUE(queue.IsEmpty());
+}
+
+TEST(UnboundedQueue, bursts_reuse_segments)
+{
+    UnboundedLFQueue<std::size_t, 16> queue{};
+
+    std::size_t allocated_segments{};
+    for (std::size_t burst{}; burst < 10; ++burst)
+    {
+        for (std::size_t i{}; i < 16 * 8; ++i)
+        {
+            std::size_t value{ i };
+            ASSERT_TRUE(queue.TryPush(value));
+        }
+
+        for (std::size_t i{}; i < 16 * 8; ++i)
+        {
+            std::size_t value{};
+            ASSERT_TRUE(queue.TryPop(value));
+            ASSERT_EQ(value, i);
+        }
+
+        // only the first burst allocates
+        if (burst == 0)
+        {
+            allocated_segments = queue.AllocatedSegments();
+        }
+
+        ASSERT_EQ(queue.AllocatedSegments(), allocated_segments);
+    }
+}
+
+TEST(UnboundedQueue, destroys_values)
+{
+    auto value{ std::make_shared<int>(0) };
+
+    {
+        UnboundedLFQueue<std::shared_ptr<int>, 4> queue{};
+        for (std::size_t i{}; i < 10; ++i)
+        {
+            auto copy{ value };
+            ASSERT_TRUE(queue.TryPush(copy));
+        }
+
+        std::shared_ptr<int> popped{};
+        ASSERT_TRUE(queue.TryPop(popped));
+        ASSERT_EQ(value.use_count(), 11);
+    }
+
+    ASSERT_EQ(value.use_count(), 1);
+}
+
+TEST(UnboundedQueue, push_pop_4c_4p)
+{
+    constexpr std::size_t ITEM_COUNT{ 100'000 };
+
+    UnboundedLFQueue<std::size_t, 64> queue{};
+
+    std::atomic<std::size_t> popped_count{};
+    std::atomic<std::size_t> sum{};
+
+    std::vector<std::thread> consumers{};
+    std::vector<std::thread> producers{};
+
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        consumers.emplace_back([&queue, &popped_count, &sum]() -> void
+        {
+            std::size_t local_sum{};
+            while (popped_count.load(std::memory_order_relaxed) < 4 * ITEM_COUNT)
+            {
+                std::size_t value{};
+                if (queue.TryPop(value))
+                {
+                    local_sum += value;
+                    popped_count.fetch_add(1, std::memory_order_relaxed);
+
+                    continue;
+                }
+
+                std::this_thread::yield();
+            }
+
+            sum.fetch_add(local_sum);
+        });
+    }
+
+    for (std::size_t i{}; i < 4; ++i)
+    {
+        producers.emplace_back([&queue]() -> void
+        {
+            for (std::size_t j{}; j < ITEM_COUNT; ++j)
+            {
+                std::size_t value{ j };
+                ASSERT_TRUE(queue.TryPush(value));
+            }
+        });
+    }
+
+    for (auto& thread : producers)
+    {
+        thread.join();
+    }
+
+    for (auto& thread : consumers)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(sum.load(), 4 * (ITEM_COUNT * (ITEM_COUNT - 1) / 2));
+    ASSERT_TRUE(queue.IsEmpty());
+}